@@ -0,0 +1,61 @@
+/**
+ * Semver - The Semantic Versioning
+ *
+ * (c) Axel Etcheverry <axel@etcheverry.biz>
+ *
+ * For the full copyright and license information, please view the LICENSE
+ * file that was distributed with this source code.
+ */
+
+#include <sstream>
+#include <benchmark/benchmark.h>
+#include <semver/format.hpp>
+
+static void BM_format_ostream(benchmark::State& state)
+{
+    semver::version value("1.22.333-beta.11+20130101133700");
+    std::ostringstream out;
+
+    for (auto _ : state)
+    {
+        out.str(std::string());
+        out << value;
+
+        benchmark::DoNotOptimize(out);
+    }
+}
+
+BENCHMARK(BM_format_ostream);
+
+static void BM_format_concat(benchmark::State& state)
+{
+    semver::version value("1.22.333-beta.11+20130101133700");
+
+    for (auto _ : state)
+    {
+        std::string out = std::to_string(value.getMajor()) + "." + std::to_string(value.getMinor()) + "." +
+            std::to_string(value.getPatch()) + "-" + value.getPreRelease();
+
+        benchmark::DoNotOptimize(out);
+    }
+}
+
+BENCHMARK(BM_format_concat);
+
+static void BM_format_to_chars(benchmark::State& state, semver::format_t format)
+{
+    semver::version value("1.22.333-beta.11+20130101133700");
+    char buffer[64];
+
+    for (auto _ : state)
+    {
+        semver::to_chars_result result = semver::to_chars(buffer, buffer + sizeof(buffer), value, format);
+
+        benchmark::DoNotOptimize(result.ptr);
+        benchmark::ClobberMemory();
+    }
+}
+
+BENCHMARK_CAPTURE(BM_format_to_chars, canonical, semver::FORMAT_CANONICAL);
+BENCHMARK_CAPTURE(BM_format_to_chars, without_build, semver::FORMAT_WITHOUT_BUILD);
+BENCHMARK_CAPTURE(BM_format_to_chars, major_minor, semver::FORMAT_MAJOR_MINOR);
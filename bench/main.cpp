@@ -0,0 +1,12 @@
+/**
+ * Semver - The Semantic Versioning
+ *
+ * (c) Axel Etcheverry <axel@etcheverry.biz>
+ *
+ * For the full copyright and license information, please view the LICENSE
+ * file that was distributed with this source code.
+ */
+
+#include <benchmark/benchmark.h>
+
+BENCHMARK_MAIN();
@@ -0,0 +1,72 @@
+/**
+ * Semver - The Semantic Versioning
+ *
+ * (c) Axel Etcheverry <axel@etcheverry.biz>
+ *
+ * For the full copyright and license information, please view the LICENSE
+ * file that was distributed with this source code.
+ */
+
+#include <benchmark/benchmark.h>
+#include <semver/version.hpp>
+
+static void BM_parse(benchmark::State& state, const char* value)
+{
+    std::string input(value);
+
+    for (auto _ : state)
+    {
+        semver::version version(input);
+
+        benchmark::DoNotOptimize(version.getMajor());
+    }
+}
+
+BENCHMARK_CAPTURE(BM_parse, simple, "1.2.3");
+BENCHMARK_CAPTURE(BM_parse, pre_release, "1.2.3-beta.11+20130101133700");
+BENCHMARK_CAPTURE(BM_parse, date, "20261019.1.0");
+BENCHMARK_CAPTURE(BM_parse, huge, "18446744073709551615.18446744073709551615.18446744073709551615");
+BENCHMARK_CAPTURE(BM_parse, overflow, "18446744073709551616.0.0");
+
+static void BM_compare(benchmark::State& state, const char* left, const char* right)
+{
+    semver::version lft(left);
+    semver::version rgt(right);
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(lft > rgt);
+    }
+}
+
+BENCHMARK_CAPTURE(BM_compare, major, "2.0.0", "1.0.0");
+BENCHMARK_CAPTURE(BM_compare, huge, "1.0.4294967297", "1.0.4294967296");
+BENCHMARK_CAPTURE(BM_compare, pre_release, "1.0.0-beta.11", "1.0.0-beta.2");
+
+static void BM_greater_equal(benchmark::State& state, const char* left, const char* right)
+{
+    semver::version lft(left);
+    semver::version rgt(right);
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(lft >= rgt);
+    }
+}
+
+BENCHMARK_CAPTURE(BM_greater_equal, major, "1.0.0", "2.0.0");
+BENCHMARK_CAPTURE(BM_greater_equal, build, "1.0.0-beta.11+20130101133700", "1.0.0-beta.11+20130101133701");
+
+static void BM_equal(benchmark::State& state, const char* left, const char* right)
+{
+    semver::version lft(left);
+    semver::version rgt(right);
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(lft == rgt);
+    }
+}
+
+BENCHMARK_CAPTURE(BM_equal, major, "1.0.0-beta.11+20130101133700", "2.0.0-beta.11+20130101133700");
+BENCHMARK_CAPTURE(BM_equal, same, "1.0.0-beta.11+20130101133700", "1.0.0-beta.11+20130101133700");
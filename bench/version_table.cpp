@@ -0,0 +1,165 @@
+/**
+ * Semver - The Semantic Versioning
+ *
+ * (c) Axel Etcheverry <axel@etcheverry.biz>
+ *
+ * For the full copyright and license information, please view the LICENSE
+ * file that was distributed with this source code.
+ */
+
+#include <random>
+#include <vector>
+#include <benchmark/benchmark.h>
+#include <semver/version_table.hpp>
+
+static const std::size_t rows = 1 << 20;
+
+static const std::vector<semver::version>& versions()
+{
+    static std::vector<semver::version> versions;
+
+    if (versions.empty())
+    {
+        std::mt19937_64 random(42);
+
+        versions.reserve(rows);
+
+        while (versions.size() < rows)
+        {
+            std::string value = std::to_string(random() % 8) + "." + std::to_string(random() % 20) + "." + std::to_string(random() % 50);
+
+            if (random() % 4 == 0)
+            {
+                value += "-beta." + std::to_string(random() % 10);
+            }
+
+            if (semver::version(value).isValid())
+            {
+                versions.push_back(semver::version(value));
+            }
+        }
+    }
+
+    return versions;
+}
+
+static const semver::version_table& table()
+{
+    static semver::version_table table;
+
+    if (table.size() == 0)
+    {
+        table.reserve(rows);
+
+        for (std::size_t i = 0; i < versions().size(); i++)
+        {
+            table.add(versions()[i]);
+        }
+    }
+
+    return table;
+}
+
+static void BM_objects_major_less(benchmark::State& state)
+{
+    const std::vector<semver::version>& values = versions();
+
+    for (auto _ : state)
+    {
+        std::size_t count = 0;
+
+        for (std::size_t i = 0; i < values.size(); i++)
+        {
+            count += values[i].getMajor() < 2;
+        }
+
+        benchmark::DoNotOptimize(count);
+    }
+
+    state.SetItemsProcessed(state.iterations() * values.size());
+}
+
+static void BM_table_major_less(benchmark::State& state)
+{
+    const semver::version_table& values = table();
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(values.select(semver::version_table::COLUMN_MAJOR, semver::version_table::COMPARE_LESS, 2).count());
+    }
+
+    state.SetItemsProcessed(state.iterations() * values.size());
+}
+
+static void BM_objects_stable(benchmark::State& state)
+{
+    const std::vector<semver::version>& values = versions();
+
+    for (auto _ : state)
+    {
+        std::size_t count = 0;
+
+        for (std::size_t i = 0; i < values.size(); i++)
+        {
+            count += values[i].isStable();
+        }
+
+        benchmark::DoNotOptimize(count);
+    }
+
+    state.SetItemsProcessed(state.iterations() * values.size());
+}
+
+static void BM_table_stable(benchmark::State& state)
+{
+    const semver::version_table& values = table();
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(values.stable().count());
+    }
+
+    state.SetItemsProcessed(state.iterations() * values.size());
+}
+
+static void BM_objects_between(benchmark::State& state)
+{
+    const std::vector<semver::version>& values = versions();
+    semver::version low("2.5.0-beta.3");
+    semver::version high("5.0.0");
+
+    for (auto _ : state)
+    {
+        std::size_t count = 0;
+
+        for (std::size_t i = 0; i < values.size(); i++)
+        {
+            count += !(values[i] < low) && values[i] < high;
+        }
+
+        benchmark::DoNotOptimize(count);
+    }
+
+    state.SetItemsProcessed(state.iterations() * values.size());
+}
+
+static void BM_table_between(benchmark::State& state)
+{
+    const semver::version_table& values = table();
+    semver::version low("2.5.0-beta.3");
+    semver::version high("5.0.0");
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(values.between(low, high).count());
+    }
+
+    state.SetItemsProcessed(state.iterations() * values.size());
+}
+
+BENCHMARK(BM_objects_major_less);
+BENCHMARK(BM_table_major_less);
+BENCHMARK(BM_objects_stable);
+BENCHMARK(BM_table_stable);
+BENCHMARK(BM_objects_between);
+BENCHMARK(BM_table_between);
@@ -0,0 +1,56 @@
+/**
+ * Semver - The Semantic Versioning
+ *
+ * (c) Axel Etcheverry <axel@etcheverry.biz>
+ *
+ * For the full copyright and license information, please view the LICENSE
+ * file that was distributed with this source code.
+ */
+
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include "differential.hpp"
+
+/**
+ * Usage: semver-differential [iterations] [seed]
+ *
+ * Generates iterations pairs of versions and checks parse and precedence
+ * against the reference implementation, exits non-zero on the first mismatch.
+ */
+int main(int argc, char** argv)
+{
+    std::uint64_t iterations = (argc > 1) ? std::strtoull(argv[1], nullptr, 10) : 1000000;
+    std::uint64_t seed = (argc > 2) ? std::strtoull(argv[2], nullptr, 10) : 0;
+
+    semver_differential::generator generator(seed);
+
+    for (std::uint64_t i = 0; i < iterations; i++)
+    {
+        std::string left = generator.next();
+        std::string right = generator.next(left);
+        std::string error = semver_differential::check_parse(left);
+
+        if (error.empty())
+        {
+            error = semver_differential::check_parse(right);
+        }
+
+        if (error.empty())
+        {
+            error = semver_differential::check_compare(left, right);
+        }
+
+        if (!error.empty())
+        {
+            std::cerr << "iteration " << i << " (seed " << seed << "): " << error << std::endl;
+
+            return 1;
+        }
+    }
+
+    std::cout << iterations << " iterations, no mismatch" << std::endl;
+
+    return 0;
+}
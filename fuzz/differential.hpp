@@ -0,0 +1,275 @@
+#pragma once
+/**
+ * Semver - The Semantic Versioning
+ *
+ * (c) Axel Etcheverry <axel@etcheverry.biz>
+ *
+ * For the full copyright and license information, please view the LICENSE
+ * file that was distributed with this source code.
+ */
+
+#include <cstdint>
+#include <random>
+#include <string>
+#include <semver/format.hpp>
+#include <semver/version.hpp>
+#include "reference.hpp"
+
+/**
+ * Checks semver::version against the reference implementation. Every check
+ * returns an empty string on success and a description of the mismatch
+ * otherwise, so callers decide whether to abort, report or count.
+ */
+namespace semver_differential {
+
+    inline std::string quote(const std::string& value)
+    {
+        return "\"" + value + "\"";
+    }
+
+    /**
+     * Parse value with both implementations and compare every field
+     */
+    inline std::string check_parse(const std::string& value)
+    {
+        semver::version version(value);
+        semver_reference::version reference = semver_reference::parse(value);
+
+        if (version.isValid() != reference.valid)
+        {
+            return quote(value) + ": isValid() is " + (version.isValid() ? "true" : "false");
+        }
+
+        if (!reference.valid)
+        {
+            return "";
+        }
+
+        if (
+            version.getMajor() != reference.major ||
+            version.getMinor() != reference.minor ||
+            version.getPatch() != reference.patch
+        )
+        {
+            return quote(value) + ": numeric components differ";
+        }
+
+        if (version.getPreRelease() != semver_reference::join(reference.pre_release, '.'))
+        {
+            return quote(value) + ": getPreRelease() is " + quote(version.getPreRelease());
+        }
+
+        if (version.getBuild() != semver_reference::join(reference.build, '.'))
+        {
+            return quote(value) + ": getBuild() is " + quote(version.getBuild());
+        }
+
+        if (version.isStable() != (reference.major > 0 && reference.pre_release.empty()))
+        {
+            return quote(value) + ": isStable() is " + (version.isStable() ? "true" : "false");
+        }
+
+        // the string rebuilt from the parsed fields, the canonical format
+        // would copy the stored input
+        std::string formatted = semver::to_string(version, semver::FORMAT_WITHOUT_BUILD);
+
+        if (!version.getBuild().empty())
+        {
+            formatted += '+';
+            formatted += version.getBuild();
+        }
+
+        if (formatted != value)
+        {
+            return quote(value) + ": round-trip gives " + quote(formatted);
+        }
+
+        semver::version reparsed(formatted);
+
+        if (
+            !reparsed.isValid() ||
+            reparsed.getMajor() != version.getMajor() ||
+            reparsed.getMinor() != version.getMinor() ||
+            reparsed.getPatch() != version.getPatch() ||
+            reparsed.getPreRelease() != version.getPreRelease() ||
+            reparsed.getBuild() != version.getBuild() ||
+            reparsed.getPreReleaseRank() != version.getPreReleaseRank() ||
+            reparsed.isStable() != version.isStable()
+        )
+        {
+            return quote(value) + ": parsing " + quote(formatted) + " again gives other fields";
+        }
+
+        return "";
+    }
+
+    /**
+     * Compare the precedence of two values with both implementations, values
+     * the reference rejects are skipped
+     */
+    inline std::string check_compare(const std::string& left, const std::string& right)
+    {
+        semver_reference::version lft_reference = semver_reference::parse(left);
+        semver_reference::version rgt_reference = semver_reference::parse(right);
+
+        if (!lft_reference.valid || !rgt_reference.valid)
+        {
+            return "";
+        }
+
+        semver::version lft(left);
+        semver::version rgt(right);
+        int expected = semver_reference::compare(lft_reference, rgt_reference);
+
+        if ((lft > rgt) != (expected > 0) || (lft < rgt) != (expected < 0))
+        {
+            return quote(left) + " <=> " + quote(right) + ": expected " + std::to_string(expected);
+        }
+
+        return "";
+    }
+
+    /**
+     * Generate inputs biased towards the interesting corners of the grammar:
+     * leading zeros, 64-bit limits, empty identifiers and stray separators
+     */
+    class generator
+    {
+    private:
+        std::mt19937_64 m_random;
+
+        std::size_t pick(std::size_t count)
+        {
+            return static_cast<std::size_t>(m_random() % count);
+        }
+
+        std::string number()
+        {
+            static const char* const numbers[] = {
+                "0", "1", "2", "9", "10", "11", "00", "01", "007", "42",
+                "4294967295", "4294967296", "20261019",
+                "18446744073709551615", "18446744073709551616", "99999999999999999999"
+            };
+
+            if (pick(4) == 0)
+            {
+                return std::to_string(m_random() >> pick(64));
+            }
+
+            return numbers[pick(sizeof(numbers) / sizeof(numbers[0]))];
+        }
+
+        std::string identifier()
+        {
+            static const char* const identifiers[] = {
+                "alpha", "beta", "rc", "dev", "SNAPSHOT", "a", "A", "z", "-", "--",
+                "x-1", "0a", "a0", "rc-beta", "alpha-", "ALPHA", ""
+            };
+
+            if (pick(3) == 0)
+            {
+                return number();
+            }
+
+            return identifiers[pick(sizeof(identifiers) / sizeof(identifiers[0]))];
+        }
+
+        std::string identifiers()
+        {
+            std::string value = identifier();
+            std::size_t count = pick(4);
+
+            for (std::size_t i = 0; i < count; i++)
+            {
+                value += '.';
+                value += identifier();
+            }
+
+            return value;
+        }
+
+        std::string mutate(std::string value)
+        {
+            static const char alphabet[] = "0123456789.-+azAZ_ \x7f";
+            std::size_t position = value.empty() ? 0 : pick(value.length() + 1);
+            char chr = alphabet[pick(sizeof(alphabet) - 1)];
+
+            switch (pick(3))
+            {
+                case 0:
+                    return value.insert(position, 1, chr);
+
+                case 1:
+                    return value.empty() ? value : value.erase(position % value.length(), 1);
+
+                default:
+                    if (!value.empty())
+                    {
+                        value[position % value.length()] = chr;
+                    }
+
+                    return value;
+            }
+        }
+
+    public:
+        explicit generator(std::uint64_t seed)
+            : m_random(seed)
+        {
+        }
+
+        std::string next()
+        {
+            std::string value = number() + "." + number() + "." + number();
+
+            if (pick(2) == 0)
+            {
+                value += '-';
+                value += identifiers();
+            }
+
+            if (pick(3) == 0)
+            {
+                value += '+';
+                value += identifiers();
+            }
+
+            if (pick(4) == 0)
+            {
+                value = mutate(value);
+            }
+
+            return value;
+        }
+
+        /**
+         * Generate a value close to base so that comparisons reach the
+         * pre-release rules instead of stopping at the major
+         */
+        std::string next(const std::string& base)
+        {
+            std::size_t end = base.find_first_of("-+");
+            std::string value = base.substr(0, end);
+
+            if (pick(4) == 0)
+            {
+                return next();
+            }
+
+            if (pick(3) != 0)
+            {
+                value += '-';
+                value += identifiers();
+            }
+
+            if (pick(3) == 0)
+            {
+                value += '+';
+                value += identifiers();
+            }
+
+            return value;
+        }
+    };
+
+} // end semver_differential namespace
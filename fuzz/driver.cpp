@@ -0,0 +1,42 @@
+/**
+ * Semver - The Semantic Versioning
+ *
+ * (c) Axel Etcheverry <axel@etcheverry.biz>
+ *
+ * For the full copyright and license information, please view the LICENSE
+ * file that was distributed with this source code.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+
+extern "C" int LLVMFuzzerTestOneInput(const std::uint8_t* data, std::size_t size);
+
+/**
+ * Replays the files given on the command line through the fuzz target, for
+ * compilers without libFuzzer
+ */
+int main(int argc, char** argv)
+{
+    for (int i = 1; i < argc; i++)
+    {
+        std::ifstream file(argv[i], std::ios::binary);
+
+        if (!file)
+        {
+            std::cerr << "cannot open " << argv[i] << std::endl;
+
+            return 1;
+        }
+
+        std::string input((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+        LLVMFuzzerTestOneInput(reinterpret_cast<const std::uint8_t*>(input.data()), input.size());
+    }
+
+    return 0;
+}
@@ -0,0 +1,284 @@
+#pragma once
+/**
+ * Semver - The Semantic Versioning
+ *
+ * (c) Axel Etcheverry <axel@etcheverry.biz>
+ *
+ * For the full copyright and license information, please view the LICENSE
+ * file that was distributed with this source code.
+ */
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * Straightforward implementation of the semver 2.0.0 grammar and precedence
+ * rules, written for clarity rather than speed. It is the oracle the library
+ * is checked against, so keep it independent from semver/version.hpp.
+ *
+ * Deviations from the specification, shared with the library:
+ *  - numeric components must fit in 64 bits
+ *  - 0.0.0 is not a valid version
+ */
+namespace semver_reference {
+
+    struct version
+    {
+        bool valid;
+        std::uint64_t major;
+        std::uint64_t minor;
+        std::uint64_t patch;
+        std::vector<std::string> pre_release;
+        std::vector<std::string> build;
+    };
+
+    inline std::vector<std::string> split(const std::string& value, char separator)
+    {
+        std::vector<std::string> parts;
+        std::string part;
+
+        for (std::size_t i = 0; i < value.length(); i++)
+        {
+            if (value[i] == separator)
+            {
+                parts.push_back(part);
+                part.clear();
+            }
+            else
+            {
+                part += value[i];
+            }
+        }
+
+        parts.push_back(part);
+
+        return parts;
+    }
+
+    inline std::string join(const std::vector<std::string>& parts, char separator)
+    {
+        std::string value;
+
+        for (std::size_t i = 0; i < parts.size(); i++)
+        {
+            if (i > 0)
+            {
+                value += separator;
+            }
+
+            value += parts[i];
+        }
+
+        return value;
+    }
+
+    inline bool is_numeric(const std::string& value)
+    {
+        if (value.empty())
+        {
+            return false;
+        }
+
+        for (std::size_t i = 0; i < value.length(); i++)
+        {
+            if (value[i] < '0' || value[i] > '9')
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    inline bool is_alphanumeric(const std::string& value)
+    {
+        if (value.empty())
+        {
+            return false;
+        }
+
+        for (std::size_t i = 0; i < value.length(); i++)
+        {
+            char chr = value[i];
+
+            if (!((chr >= '0' && chr <= '9') || (chr >= 'A' && chr <= 'Z') || (chr >= 'a' && chr <= 'z') || chr == '-'))
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    // <numeric identifier> ::= "0" | <positive digit> <digits>
+    inline bool is_numeric_identifier(const std::string& value)
+    {
+        return is_numeric(value) && (value.length() == 1 || value[0] != '0');
+    }
+
+    inline bool to_number(const std::string& value, std::uint64_t& number)
+    {
+        const std::string max = "18446744073709551615";
+
+        if (!is_numeric_identifier(value))
+        {
+            return false;
+        }
+
+        if (value.length() > max.length() || (value.length() == max.length() && value > max))
+        {
+            return false;
+        }
+
+        number = 0;
+
+        for (std::size_t i = 0; i < value.length(); i++)
+        {
+            number = number * 10 + (value[i] - '0');
+        }
+
+        return true;
+    }
+
+    inline version parse(const std::string& value)
+    {
+        version result = { false, 0, 0, 0, {}, {} };
+        std::string rest = value;
+
+        std::size_t plus = rest.find('+');
+
+        if (plus != std::string::npos)
+        {
+            result.build = split(rest.substr(plus + 1), '.');
+            rest = rest.substr(0, plus);
+
+            for (std::size_t i = 0; i < result.build.size(); i++)
+            {
+                if (!is_alphanumeric(result.build[i]))
+                {
+                    return result;
+                }
+            }
+        }
+
+        std::size_t minus = rest.find('-');
+
+        if (minus != std::string::npos)
+        {
+            result.pre_release = split(rest.substr(minus + 1), '.');
+            rest = rest.substr(0, minus);
+
+            for (std::size_t i = 0; i < result.pre_release.size(); i++)
+            {
+                const std::string& identifier = result.pre_release[i];
+
+                if (!is_alphanumeric(identifier))
+                {
+                    return result;
+                }
+
+                if (is_numeric(identifier) && !is_numeric_identifier(identifier))
+                {
+                    return result;
+                }
+            }
+        }
+
+        std::vector<std::string> core = split(rest, '.');
+
+        if (core.size() != 3)
+        {
+            return result;
+        }
+
+        if (!to_number(core[0], result.major) || !to_number(core[1], result.minor) || !to_number(core[2], result.patch))
+        {
+            return result;
+        }
+
+        result.valid = !(result.major == 0 && result.minor == 0 && result.patch == 0);
+
+        return result;
+    }
+
+    inline int compare_identifier(const std::string& lft, const std::string& rgt)
+    {
+        bool lft_numeric = is_numeric(lft);
+        bool rgt_numeric = is_numeric(rgt);
+
+        if (lft_numeric && rgt_numeric)
+        {
+            std::uint64_t lft_number = 0, rgt_number = 0;
+
+            // numeric identifiers are not limited to 64 bits, compare as strings
+            if (!to_number(lft, lft_number) || !to_number(rgt, rgt_number))
+            {
+                if (lft.length() != rgt.length())
+                {
+                    return lft.length() < rgt.length() ? -1 : 1;
+                }
+
+                return lft < rgt ? -1 : (lft > rgt ? 1 : 0);
+            }
+
+            return lft_number < rgt_number ? -1 : (lft_number > rgt_number ? 1 : 0);
+        }
+
+        if (lft_numeric)
+        {
+            return -1;
+        }
+
+        if (rgt_numeric)
+        {
+            return 1;
+        }
+
+        return lft < rgt ? -1 : (lft > rgt ? 1 : 0);
+    }
+
+    /**
+     * Compare the precedence of two valid versions, build metadata is ignored
+     */
+    inline int compare(const version& lft, const version& rgt)
+    {
+        if (lft.major != rgt.major)
+        {
+            return lft.major < rgt.major ? -1 : 1;
+        }
+
+        if (lft.minor != rgt.minor)
+        {
+            return lft.minor < rgt.minor ? -1 : 1;
+        }
+
+        if (lft.patch != rgt.patch)
+        {
+            return lft.patch < rgt.patch ? -1 : 1;
+        }
+
+        if (lft.pre_release.empty() || rgt.pre_release.empty())
+        {
+            return (int) lft.pre_release.empty() - (int) rgt.pre_release.empty();
+        }
+
+        for (std::size_t i = 0; i < lft.pre_release.size() && i < rgt.pre_release.size(); i++)
+        {
+            int result = compare_identifier(lft.pre_release[i], rgt.pre_release[i]);
+
+            if (result != 0)
+            {
+                return result;
+            }
+        }
+
+        if (lft.pre_release.size() != rgt.pre_release.size())
+        {
+            return lft.pre_release.size() < rgt.pre_release.size() ? -1 : 1;
+        }
+
+        return 0;
+    }
+
+} // end semver_reference namespace
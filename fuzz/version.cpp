@@ -0,0 +1,51 @@
+/**
+ * Semver - The Semantic Versioning
+ *
+ * (c) Axel Etcheverry <axel@etcheverry.biz>
+ *
+ * For the full copyright and license information, please view the LICENSE
+ * file that was distributed with this source code.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include "differential.hpp"
+
+static void check(const std::string& error)
+{
+    if (!error.empty())
+    {
+        std::fprintf(stderr, "%s\n", error.c_str());
+        std::abort();
+    }
+}
+
+/**
+ * libFuzzer entry point: the input is one version, or two versions separated
+ * by a new line to also exercise the comparison operators
+ */
+extern "C" int LLVMFuzzerTestOneInput(const std::uint8_t* data, std::size_t size)
+{
+    std::string input(reinterpret_cast<const char*>(data), size);
+    std::size_t separator = input.find('\n');
+
+    if (separator == std::string::npos)
+    {
+        check(semver_differential::check_parse(input));
+
+        return 0;
+    }
+
+    std::string left = input.substr(0, separator);
+    std::string right = input.substr(separator + 1);
+
+    check(semver_differential::check_parse(left));
+    check(semver_differential::check_parse(right));
+    check(semver_differential::check_compare(left, right));
+    check(semver_differential::check_compare(right, left));
+
+    return 0;
+}
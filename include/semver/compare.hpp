@@ -0,0 +1,93 @@
+#pragma once
+/**
+ * Semver - The Semantic Versioning
+ *
+ * (c) Axel Etcheverry <axel@etcheverry.biz>
+ *
+ * For the full copyright and license information, please view the LICENSE
+ * file that was distributed with this source code.
+ */
+
+#include <string>
+#include <semver/version.hpp>
+
+namespace semver {
+
+    enum COMPARISON {
+        // build metadata ignored, 1.0.0+a equals 1.0.0+b
+        COMPARISON_PRECEDENCE,
+        // precedence, then the build identifiers, numeric ones numerically
+        COMPARISON_BUILD,
+        // precedence, then the build bytes; invalid versions come first,
+        // ordered by their string
+        COMPARISON_EXACT
+    };
+
+    typedef enum COMPARISON comparison_t;
+
+    /**
+     * Compare two versions on their parsed fields: -1, 0 or 1
+     */
+    inline int compare(const version& lft, const version& rgt, comparison_t mode)
+    {
+        if (mode == COMPARISON_EXACT && (!lft.isValid() || !rgt.isValid()))
+        {
+            if (lft.isValid() != rgt.isValid())
+            {
+                return lft.isValid() ? 1 : -1;
+            }
+
+            int result = lft.getVersion().compare(rgt.getVersion());
+
+            return (result == 0) ? 0 : ((result < 0) ? -1 : 1);
+        }
+
+        int result = lft.comparePrecedence(rgt);
+
+        if (result != 0 || mode == COMPARISON_PRECEDENCE)
+        {
+            return result;
+        }
+
+        if (mode == COMPARISON_BUILD)
+        {
+            return lft.compareBuild(rgt);
+        }
+
+        result = lft.getBuild().compare(rgt.getBuild());
+
+        return (result == 0) ? 0 : ((result < 0) ? -1 : 1);
+    }
+
+    /**
+     * Strict weak ordering for std::sort, std::set or std::map
+     */
+    template <comparison_t Mode>
+    struct less
+    {
+        bool operator() (const version& lft, const version& rgt) const
+        {
+            return compare(lft, rgt, Mode) < 0;
+        }
+    };
+
+    /**
+     * Equivalence of less<Mode>, for std::unique
+     */
+    template <comparison_t Mode>
+    struct equal_to
+    {
+        bool operator() (const version& lft, const version& rgt) const
+        {
+            return compare(lft, rgt, Mode) == 0;
+        }
+    };
+
+    typedef less<COMPARISON_PRECEDENCE> precedence_less;
+    typedef equal_to<COMPARISON_PRECEDENCE> precedence_equal;
+    typedef less<COMPARISON_BUILD> build_less;
+    typedef equal_to<COMPARISON_BUILD> build_equal;
+    typedef less<COMPARISON_EXACT> exact_less;
+    typedef equal_to<COMPARISON_EXACT> exact_equal;
+
+} // end semver namespace
@@ -0,0 +1,46 @@
+#pragma once
+/**
+ * Semver - The Semantic Versioning
+ *
+ * (c) Axel Etcheverry <axel@etcheverry.biz>
+ *
+ * For the full copyright and license information, please view the LICENSE
+ * file that was distributed with this source code.
+ */
+
+#include <fmt/format.h>
+#include <semver/format.hpp>
+
+/**
+ * Formatter for the fmt library, kept apart from format.hpp so the library
+ * does not depend on fmt: fmt::format("{}", value), "{:p}" without build,
+ * "{:m}" major.minor
+ */
+template <>
+struct fmt::formatter<semver::version>
+{
+    semver::format_t m_format = semver::FORMAT_CANONICAL;
+
+    FMT_CONSTEXPR auto parse(format_parse_context& ctx) -> decltype(ctx.begin())
+    {
+        auto it = ctx.begin();
+
+        if (it != ctx.end() && semver::detail::is_format_spec(*it))
+        {
+            m_format = semver::detail::get_format_spec(*it++);
+        }
+
+        if (it != ctx.end() && *it != '}')
+        {
+            throw format_error("invalid format spec for semver::version");
+        }
+
+        return it;
+    }
+
+    template <typename FormatContext>
+    auto format(const semver::version& value, FormatContext& ctx) const -> decltype(ctx.out())
+    {
+        return semver::format_to(ctx.out(), value, m_format);
+    }
+};
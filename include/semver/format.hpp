@@ -0,0 +1,286 @@
+#pragma once
+/**
+ * Semver - The Semantic Versioning
+ *
+ * (c) Axel Etcheverry <axel@etcheverry.biz>
+ *
+ * For the full copyright and license information, please view the LICENSE
+ * file that was distributed with this source code.
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <system_error>
+#include <semver/version.hpp>
+
+// __cpp_lib_format is only defined by <version> and <format>
+#if defined(__has_include)
+#if __has_include(<version>)
+#include <version>
+#endif
+#endif
+
+#if defined(__cpp_lib_format)
+#include <format>
+#endif
+
+namespace semver {
+
+    enum FORMAT {
+        // major.minor.patch[-pre-release][+build]
+        FORMAT_CANONICAL,
+        // major.minor.patch[-pre-release], the part used for precedence
+        FORMAT_WITHOUT_BUILD,
+        // major.minor
+        FORMAT_MAJOR_MINOR
+    };
+
+    typedef enum FORMAT format_t;
+
+    /**
+     * Same members as std::to_chars_result, which is C++17
+     */
+    struct to_chars_result
+    {
+        char* ptr;
+        std::errc ec;
+    };
+
+    namespace detail {
+
+        inline std::size_t count_digits(std::uint64_t value)
+        {
+            std::size_t digits = 1;
+
+            for (;;)
+            {
+                if (value < 10) return digits;
+                if (value < 100) return digits + 1;
+                if (value < 1000) return digits + 2;
+                if (value < 10000) return digits + 3;
+
+                value /= 10000;
+                digits += 4;
+            }
+        }
+
+        /**
+         * Write the digits of value backwards from last, two at a time
+         */
+        inline void write_digits(char* last, std::uint64_t value)
+        {
+            static const char pairs[] =
+                "00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+                "40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+                "8081828384858687888990919293949596979899";
+
+            while (value >= 100)
+            {
+                std::size_t index = static_cast<std::size_t>(value % 100) * 2;
+
+                value /= 100;
+                *--last = pairs[index + 1];
+                *--last = pairs[index];
+            }
+
+            if (value >= 10)
+            {
+                std::size_t index = static_cast<std::size_t>(value) * 2;
+
+                *--last = pairs[index + 1];
+                *--last = pairs[index];
+            }
+            else
+            {
+                *--last = static_cast<char>('0' + value);
+            }
+        }
+
+        template <typename OutputIt>
+        OutputIt write_number(OutputIt out, std::uint64_t value)
+        {
+            char buffer[20];
+
+            write_digits(buffer + 20, value);
+
+            return std::copy(buffer + 20 - count_digits(value), buffer + 20, out);
+        }
+
+    } // end detail namespace
+
+    /**
+     * Number of characters written by format_to() or to_chars()
+     */
+    inline std::size_t formatted_size(const version& value, format_t format = FORMAT_CANONICAL)
+    {
+        if (!value.isValid() || format == FORMAT_CANONICAL)
+        {
+            return value.getVersion().length();
+        }
+
+        std::size_t size = detail::count_digits(value.getMajor()) + 1 + detail::count_digits(value.getMinor());
+
+        if (format == FORMAT_MAJOR_MINOR)
+        {
+            return size;
+        }
+
+        size += 1 + detail::count_digits(value.getPatch());
+
+        if (!value.getPreRelease().empty())
+        {
+            size += 1 + value.getPreRelease().length();
+        }
+
+        return size;
+    }
+
+    /**
+     * Write a version to an output iterator. A valid version was parsed
+     * from its canonical form, which is copied; the other formats are
+     * written from the parsed fields. An invalid version is written as given.
+     */
+    template <typename OutputIt>
+    OutputIt format_to(OutputIt out, const version& value, format_t format = FORMAT_CANONICAL)
+    {
+        if (!value.isValid() || format == FORMAT_CANONICAL)
+        {
+            return std::copy(value.getVersion().begin(), value.getVersion().end(), out);
+        }
+
+        out = detail::write_number(out, value.getMajor());
+        *out++ = '.';
+        out = detail::write_number(out, value.getMinor());
+
+        if (format == FORMAT_MAJOR_MINOR)
+        {
+            return out;
+        }
+
+        *out++ = '.';
+        out = detail::write_number(out, value.getPatch());
+
+        if (!value.getPreRelease().empty())
+        {
+            *out++ = '-';
+            out = std::copy(value.getPreRelease().begin(), value.getPreRelease().end(), out);
+        }
+
+        return out;
+    }
+
+    /**
+     * Write a version to [first, last) without terminating null, ec is
+     * std::errc::value_too_large and nothing is written when it does not fit
+     */
+    inline to_chars_result to_chars(char* first, char* last, const version& value, format_t format = FORMAT_CANONICAL)
+    {
+        std::size_t size = formatted_size(value, format);
+        to_chars_result result = { last, std::errc::value_too_large };
+
+        if (static_cast<std::size_t>(last - first) < size)
+        {
+            return result;
+        }
+
+        if (!value.isValid() || format == FORMAT_CANONICAL)
+        {
+            result.ptr = std::copy(value.getVersion().begin(), value.getVersion().end(), first);
+            result.ec = std::errc();
+
+            return result;
+        }
+
+        // the sizes are known, numbers are written in place
+        char* out = first + detail::count_digits(value.getMajor());
+
+        detail::write_digits(out, value.getMajor());
+        *out++ = '.';
+        out += detail::count_digits(value.getMinor());
+        detail::write_digits(out, value.getMinor());
+
+        if (format != FORMAT_MAJOR_MINOR)
+        {
+            *out++ = '.';
+            out += detail::count_digits(value.getPatch());
+            detail::write_digits(out, value.getPatch());
+
+            if (!value.getPreRelease().empty())
+            {
+                *out++ = '-';
+                out = std::copy(value.getPreRelease().begin(), value.getPreRelease().end(), out);
+            }
+        }
+
+        result.ptr = out;
+        result.ec = std::errc();
+
+        return result;
+    }
+
+    inline std::string to_string(const version& value, format_t format = FORMAT_CANONICAL)
+    {
+        std::string result(formatted_size(value, format), '\0');
+
+        if (!result.empty())
+        {
+            to_chars(&result[0], &result[0] + result.size(), value, format);
+        }
+
+        return result;
+    }
+
+    namespace detail {
+
+        /**
+         * Format spec shared by the fmt and std formatters: empty or c for
+         * canonical, p for without build, m for major.minor
+         */
+        constexpr bool is_format_spec(char chr)
+        {
+            return chr == 'c' || chr == 'p' || chr == 'm';
+        }
+
+        constexpr format_t get_format_spec(char chr)
+        {
+            return (chr == 'p') ? FORMAT_WITHOUT_BUILD : (chr == 'm') ? FORMAT_MAJOR_MINOR : FORMAT_CANONICAL;
+        }
+
+    } // end detail namespace
+
+} // end semver namespace
+
+#if defined(__cpp_lib_format)
+
+template <>
+struct std::formatter<semver::version, char>
+{
+    semver::format_t m_format = semver::FORMAT_CANONICAL;
+
+    constexpr auto parse(std::format_parse_context& ctx)
+    {
+        auto it = ctx.begin();
+
+        if (it != ctx.end() && semver::detail::is_format_spec(*it))
+        {
+            m_format = semver::detail::get_format_spec(*it++);
+        }
+
+        if (it != ctx.end() && *it != '}')
+        {
+            throw std::format_error("invalid format spec for semver::version");
+        }
+
+        return it;
+    }
+
+    template <typename FormatContext>
+    auto format(const semver::version& value, FormatContext& ctx) const
+    {
+        return semver::format_to(ctx.out(), value, m_format);
+    }
+};
+
+#endif
@@ -0,0 +1,210 @@
+#pragma once
+/**
+ * Semver - The Semantic Versioning
+ *
+ * (c) Axel Etcheverry <axel@etcheverry.biz>
+ *
+ * For the full copyright and license information, please view the LICENSE
+ * file that was distributed with this source code.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace semver {
+
+    enum PRE_RELEASE {
+        PRE_RELEASE_ALPHA,
+        PRE_RELEASE_BETA,
+        PRE_RELEASE_RC,
+        PRE_RELEASE_NONE,
+        PRE_RELEASE_UNKNOWN
+    };
+
+    typedef enum PRE_RELEASE pre_release_t;
+
+    /**
+     * Maps the first pre-release identifier (the label) to a rank.
+     *
+     * Versions with different ranks are ordered by rank, versions with the
+     * same rank fall back to the semver identifier ordering. Labels missing
+     * from the table get the default rank, so a table only has to list the
+     * labels it wants to move around.
+     *
+     * The table is a perfect hash built on insertion: a lookup costs one
+     * hash of the label and a single slot probe.
+     */
+    class pre_release_table
+    {
+    public:
+        enum { default_rank = 0 };
+
+        struct entry
+        {
+            std::string label;
+            int rank;
+            pre_release_t type;
+        };
+
+    private:
+        std::vector<entry> m_entries;
+        std::vector<int> m_slots;
+        std::uint32_t m_seed;
+        std::size_t m_mask;
+
+        static std::uint32_t hash(std::uint32_t seed, const char* data, std::size_t length)
+        {
+            // FNV-1a
+            std::uint32_t value = 2166136261u ^ seed;
+
+            for (std::size_t i = 0; i < length; i++)
+            {
+                value ^= static_cast<unsigned char>(data[i]);
+                value *= 16777619u;
+            }
+
+            return value;
+        }
+
+        bool place(std::uint32_t seed, std::size_t size)
+        {
+            m_slots.assign(size, -1);
+
+            for (std::size_t i = 0; i < m_entries.size(); i++)
+            {
+                const std::string& label = m_entries[i].label;
+                std::size_t slot = hash(seed, label.data(), label.length()) & (size - 1);
+
+                if (m_slots[slot] != -1)
+                {
+                    return false;
+                }
+
+                m_slots[slot] = static_cast<int>(i);
+            }
+
+            m_seed = seed;
+            m_mask = size - 1;
+
+            return true;
+        }
+
+        void rebuild()
+        {
+            std::size_t size = 4;
+
+            while (size < m_entries.size() * 2)
+            {
+                size <<= 1;
+            }
+
+            for (;;)
+            {
+                for (std::uint32_t seed = 0; seed < 64; seed++)
+                {
+                    if (place(seed, size))
+                    {
+                        return;
+                    }
+                }
+
+                size <<= 1;
+            }
+        }
+
+    public:
+        /**
+         * Create an empty table, every label gets the default rank
+         */
+        pre_release_table()
+        {
+            rebuild();
+        }
+
+        /**
+         * The table used when none is given: alpha < beta < rc
+         */
+        static const pre_release_table& defaults()
+        {
+            static const pre_release_table table = pre_release_table()
+                .add("alpha", default_rank, PRE_RELEASE_ALPHA)
+                .add("beta", default_rank, PRE_RELEASE_BETA)
+                .add("rc", default_rank, PRE_RELEASE_RC);
+
+            return table;
+        }
+
+        /**
+         * Add or replace a label
+         */
+        pre_release_table& add(const std::string& label, int rank, pre_release_t type = PRE_RELEASE_UNKNOWN)
+        {
+            for (std::size_t i = 0; i < m_entries.size(); i++)
+            {
+                if (m_entries[i].label == label)
+                {
+                    m_entries[i].rank = rank;
+                    m_entries[i].type = type;
+
+                    return *this;
+                }
+            }
+
+            entry value = { label, rank, type };
+
+            m_entries.push_back(value);
+
+            rebuild();
+
+            return *this;
+        }
+
+        /**
+         * Find a label, returns a null pointer when the label is unknown
+         */
+        const entry* find(const char* data, std::size_t length) const
+        {
+            int index = m_slots[hash(m_seed, data, length) & m_mask];
+
+            if (index < 0)
+            {
+                return nullptr;
+            }
+
+            const entry& value = m_entries[index];
+
+            if (value.label.compare(0, std::string::npos, data, length) != 0)
+            {
+                return nullptr;
+            }
+
+            return &value;
+        }
+
+        const entry* find(const std::string& label) const
+        {
+            return find(label.data(), label.length());
+        }
+
+        /**
+         * Get the rank of a label
+         */
+        int rank(const std::string& label) const
+        {
+            const entry* value = find(label);
+
+            return value ? value->rank : default_rank;
+        }
+
+        /**
+         * Get the number of labels
+         */
+        std::size_t size() const
+        {
+            return m_entries.size();
+        }
+    };
+
+} // end semver namespace
@@ -0,0 +1,309 @@
+#pragma once
+/**
+ * Semver - The Semantic Versioning
+ *
+ * (c) Axel Etcheverry <axel@etcheverry.biz>
+ *
+ * For the full copyright and license information, please view the LICENSE
+ * file that was distributed with this source code.
+ */
+
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <vector>
+#include <semver/version.hpp>
+
+namespace semver {
+
+    /**
+     * A set of versions, written as comparators joined by spaces (and) and
+     * by "||" (or):
+     *
+     *  - >1.2.3, >=1.2.3, <1.2.3, <=1.2.3, =1.2.3 or 1.2.3
+     *  - ~1.2.3: >=1.2.3 and major.minor.patch below 1.3.0
+     *  - ^1.2.3: >=1.2.3 and major.minor.patch below 2.0.0, ^0.2.3 below
+     *    0.3.0, ^0.0.3 below 0.0.4
+     *  - * matches every version
+     *
+     * Every set needs at least one comparator, "" or "||" are invalid.
+     *
+     * The caret and tilde upper bounds compare major.minor.patch only, so
+     * every pre-release of the excluded version stays out of the range
+     * whatever the rank of its label.
+     */
+    class range
+    {
+    private:
+        enum m_operator {
+            OPERATOR_EQUAL,
+            OPERATOR_GREATER,
+            OPERATOR_GREATER_EQUAL,
+            OPERATOR_LESS,
+            OPERATOR_LESS_EQUAL,
+            // major.minor.patch strictly below, pre-release ignored
+            OPERATOR_BELOW
+        };
+
+        struct comparator
+        {
+            int op;
+            version value;
+        };
+
+        typedef std::vector<comparator> comparators_t;
+
+        std::string m_range;
+        std::vector<comparators_t> m_sets;
+        bool m_is_valid;
+
+        static std::string upper(std::uint64_t major, std::uint64_t minor, std::uint64_t patch)
+        {
+            return std::to_string(major) + "." + std::to_string(minor) + "." + std::to_string(patch);
+        }
+
+        bool add(comparators_t& set, int op, const std::string& value)
+        {
+            comparator item = { op, version(value) };
+
+            if (!item.value.isValid())
+            {
+                return false;
+            }
+
+            set.push_back(item);
+
+            return true;
+        }
+
+        bool parse_comparator(comparators_t& set, const std::string& token)
+        {
+            const std::uint64_t max = std::numeric_limits<std::uint64_t>::max();
+
+            if (token == "*")
+            {
+                return true;
+            }
+
+            if (token[0] == '^' || token[0] == '~')
+            {
+                version value(token.substr(1));
+
+                if (!value.isValid())
+                {
+                    return false;
+                }
+
+                set.push_back(comparator { OPERATOR_GREATER_EQUAL, value });
+
+                std::uint64_t major = value.getMajor();
+                std::uint64_t minor = value.getMinor();
+                std::uint64_t patch = value.getPatch();
+
+                // no upper bound when the bumped component would overflow
+                if (token[0] == '~' || major == 0)
+                {
+                    if (token[0] == '^' && minor == 0)
+                    {
+                        return (patch == max) || add(set, OPERATOR_BELOW, upper(0, 0, patch + 1));
+                    }
+
+                    return (minor == max) || add(set, OPERATOR_BELOW, upper(major, minor + 1, 0));
+                }
+
+                return (major == max) || add(set, OPERATOR_BELOW, upper(major + 1, 0, 0));
+            }
+
+            if (token.compare(0, 2, ">=") == 0)
+            {
+                return add(set, OPERATOR_GREATER_EQUAL, token.substr(2));
+            }
+
+            if (token.compare(0, 2, "<=") == 0)
+            {
+                return add(set, OPERATOR_LESS_EQUAL, token.substr(2));
+            }
+
+            if (token[0] == '>')
+            {
+                return add(set, OPERATOR_GREATER, token.substr(1));
+            }
+
+            if (token[0] == '<')
+            {
+                return add(set, OPERATOR_LESS, token.substr(1));
+            }
+
+            if (token[0] == '=')
+            {
+                return add(set, OPERATOR_EQUAL, token.substr(1));
+            }
+
+            return add(set, OPERATOR_EQUAL, token);
+        }
+
+        void parse()
+        {
+            comparators_t set;
+            std::string pending;
+            std::size_t i = 0;
+            // comparators of the current set, * included
+            std::size_t count = 0;
+
+            for (;;)
+            {
+                std::size_t begin = m_range.find_first_not_of(" \t", i);
+                std::size_t end = (begin == std::string::npos) ? std::string::npos : m_range.find_first_of(" \t", begin);
+                std::string token = (begin == std::string::npos) ? "" : m_range.substr(begin, end - begin);
+
+                if (token.empty() || token == "||")
+                {
+                    // an empty set would match every version, only * does
+                    if (!pending.empty() || count == 0)
+                    {
+                        m_is_valid = false;
+
+                        return;
+                    }
+
+                    m_sets.push_back(set);
+                    set.clear();
+                    count = 0;
+
+                    if (token.empty())
+                    {
+                        return;
+                    }
+
+                    i = end;
+
+                    continue;
+                }
+
+                // an operator separated from its version by spaces
+                if (token.find_first_not_of("<>=^~") == std::string::npos)
+                {
+                    if (!pending.empty())
+                    {
+                        m_is_valid = false;
+
+                        return;
+                    }
+
+                    pending = token;
+                    i = end;
+
+                    continue;
+                }
+
+                if (!parse_comparator(set, pending + token))
+                {
+                    m_is_valid = false;
+
+                    return;
+                }
+
+                pending.clear();
+                count++;
+                i = end;
+            }
+        }
+
+        static bool matches(const comparator& item, const version& value)
+        {
+            switch (item.op)
+            {
+                case OPERATOR_GREATER:
+                    return value > item.value;
+
+                case OPERATOR_GREATER_EQUAL:
+                    return !(item.value > value);
+
+                case OPERATOR_LESS:
+                    return item.value > value;
+
+                case OPERATOR_LESS_EQUAL:
+                    return !(value > item.value);
+
+                case OPERATOR_BELOW:
+
+                    if (value.getMajor() != item.value.getMajor())
+                    {
+                        return value.getMajor() < item.value.getMajor();
+                    }
+
+                    if (value.getMinor() != item.value.getMinor())
+                    {
+                        return value.getMinor() < item.value.getMinor();
+                    }
+
+                    return value.getPatch() < item.value.getPatch();
+
+                default:
+                    return !(value > item.value) && !(item.value > value);
+            }
+        }
+
+    public:
+        /**
+         * Parse the range string
+         */
+        range(const std::string& range)
+        {
+            m_range     = range;
+            m_is_valid  = true;
+
+            parse();
+
+            if (!m_is_valid)
+            {
+                m_sets.clear();
+            }
+        }
+
+        /**
+         * Get full range
+         */
+        const std::string& getRange() const
+        {
+            return m_range;
+        }
+
+        /**
+         * Check if the range is valid
+         */
+        const bool& isValid() const
+        {
+            return m_is_valid;
+        }
+
+        /**
+         * Check if a valid version is in the range
+         */
+        bool contains(const version& value) const
+        {
+            if (!value.isValid())
+            {
+                return false;
+            }
+
+            for (std::size_t i = 0; i < m_sets.size(); i++)
+            {
+                bool match = true;
+
+                for (std::size_t j = 0; match && j < m_sets[i].size(); j++)
+                {
+                    match = matches(m_sets[i][j], value);
+                }
+
+                if (match)
+                {
+                    return true;
+                }
+            }
+
+            return false;
+        }
+    };
+
+} // end semver namespace
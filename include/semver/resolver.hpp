@@ -0,0 +1,742 @@
+#pragma once
+/**
+ * Semver - The Semantic Versioning
+ *
+ * (c) Axel Etcheverry <axel@etcheverry.biz>
+ *
+ * For the full copyright and license information, please view the LICENSE
+ * file that was distributed with this source code.
+ */
+
+/**
+ * Coroutine based resolution of version constraints against candidate lists
+ * loaded asynchronously from a source, requires C++20 coroutines
+ */
+#if defined(__cpp_impl_coroutine)
+
+#include <algorithm>
+#include <condition_variable>
+#include <coroutine>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <fstream>
+#include <functional>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include <semver/range.hpp>
+#include <semver/version.hpp>
+
+namespace semver {
+
+    namespace detail {
+
+        /**
+         * Eager coroutine nobody awaits, it owns its frame
+         */
+        struct detached
+        {
+            struct promise_type
+            {
+                detached get_return_object() noexcept
+                {
+                    return {};
+                }
+
+                std::suspend_never initial_suspend() noexcept
+                {
+                    return {};
+                }
+
+                std::suspend_never final_suspend() noexcept
+                {
+                    return {};
+                }
+
+                void return_void() noexcept
+                {
+                }
+
+                void unhandled_exception() noexcept
+                {
+                    std::terminate();
+                }
+            };
+        };
+
+    } // end detail namespace
+
+    /**
+     * Lazy coroutine returning a T, started when awaited
+     */
+    template <typename T>
+    class task
+    {
+    public:
+        struct promise_type
+        {
+            T value {};
+            std::exception_ptr error;
+            std::coroutine_handle<> continuation = std::noop_coroutine();
+
+            struct final_awaiter
+            {
+                bool await_ready() noexcept
+                {
+                    return false;
+                }
+
+                std::coroutine_handle<> await_suspend(std::coroutine_handle<promise_type> handle) noexcept
+                {
+                    return handle.promise().continuation;
+                }
+
+                void await_resume() noexcept
+                {
+                }
+            };
+
+            task get_return_object()
+            {
+                return task(std::coroutine_handle<promise_type>::from_promise(*this));
+            }
+
+            std::suspend_always initial_suspend() noexcept
+            {
+                return {};
+            }
+
+            final_awaiter final_suspend() noexcept
+            {
+                return {};
+            }
+
+            void return_value(T result)
+            {
+                value = std::move(result);
+            }
+
+            void unhandled_exception()
+            {
+                error = std::current_exception();
+            }
+        };
+
+    private:
+        std::coroutine_handle<promise_type> m_handle;
+
+        explicit task(std::coroutine_handle<promise_type> handle)
+            : m_handle(handle)
+        {
+        }
+
+    public:
+        task(task&& rgt) noexcept
+            : m_handle(std::exchange(rgt.m_handle, nullptr))
+        {
+        }
+
+        task(const task&) = delete;
+        task& operator= (const task&) = delete;
+
+        ~task()
+        {
+            if (m_handle)
+            {
+                m_handle.destroy();
+            }
+        }
+
+        bool await_ready() const noexcept
+        {
+            return false;
+        }
+
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<> continuation) noexcept
+        {
+            m_handle.promise().continuation = continuation;
+
+            return m_handle;
+        }
+
+        T await_resume()
+        {
+            if (m_handle.promise().error)
+            {
+                std::rethrow_exception(m_handle.promise().error);
+            }
+
+            return std::move(m_handle.promise().value);
+        }
+    };
+
+    /**
+     * Single thread run loop: resumes the posted work until nothing is queued
+     * nor expected. Sources complete their fetches from any thread.
+     */
+    class scheduler
+    {
+    private:
+        std::mutex m_mutex;
+        std::condition_variable m_ready;
+        std::deque<std::function<void()>> m_queue;
+        std::size_t m_expected = 0;
+
+    public:
+        void post(std::function<void()> work)
+        {
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+
+                m_queue.push_back(std::move(work));
+            }
+
+            m_ready.notify_one();
+        }
+
+        /**
+         * Announce work that a later complete() will post
+         */
+        void expect()
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+
+            m_expected++;
+        }
+
+        void complete(std::function<void()> work)
+        {
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+
+                m_queue.push_back(std::move(work));
+                m_expected--;
+            }
+
+            m_ready.notify_one();
+        }
+
+        void run()
+        {
+            for (;;)
+            {
+                std::function<void()> work;
+
+                {
+                    std::unique_lock<std::mutex> lock(m_mutex);
+
+                    m_ready.wait(lock, [this] { return !m_queue.empty() || m_expected == 0; });
+
+                    if (m_queue.empty())
+                    {
+                        return;
+                    }
+
+                    work = std::move(m_queue.front());
+                    m_queue.pop_front();
+                }
+
+                work();
+            }
+        }
+    };
+
+    /**
+     * Where the candidate versions of a package come from. fetch() returns
+     * at once and calls done, from any thread, with true and the raw version
+     * strings, an unknown package gives an empty list. A fetch that failed
+     * gives false, the resolver does not keep it.
+     */
+    class source
+    {
+    public:
+        typedef std::function<void(bool, std::vector<std::string>)> callback_t;
+
+        virtual ~source()
+        {
+        }
+
+        virtual void fetch(const std::string& package, callback_t done) = 0;
+    };
+
+    class memory_source : public source
+    {
+    private:
+        std::unordered_map<std::string, std::vector<std::string>> m_packages;
+
+    public:
+        memory_source& add(const std::string& package, const std::string& value)
+        {
+            m_packages[package].push_back(value);
+
+            return *this;
+        }
+
+        void fetch(const std::string& package, callback_t done) override
+        {
+            auto it = m_packages.find(package);
+
+            done(true, (it == m_packages.end()) ? std::vector<std::string>() : it->second);
+        }
+    };
+
+    /**
+     * Reads <directory>/<package>, one version per line, on its own worker
+     * thread. A missing or unreadable file is a failed fetch, a package name
+     * leaving the directory is an unknown package.
+     */
+    class file_source : public source
+    {
+    private:
+        std::string m_directory;
+        std::mutex m_mutex;
+        std::condition_variable m_ready;
+        std::deque<std::pair<std::string, callback_t>> m_queue;
+        bool m_stopped = false;
+        std::thread m_worker;
+
+        bool read(const std::string& package, std::vector<std::string>& lines) const
+        {
+            // a package name never leaves the directory
+            if (package.empty() || package[0] == '.' || package.find('/') != std::string::npos)
+            {
+                return true;
+            }
+
+            std::ifstream in(m_directory + "/" + package);
+            std::string line;
+
+            if (!in.is_open())
+            {
+                return false;
+            }
+
+            while (std::getline(in, line))
+            {
+                if (!line.empty() && line.back() == '\r')
+                {
+                    line.pop_back();
+                }
+
+                if (!line.empty())
+                {
+                    lines.push_back(line);
+                }
+            }
+
+            return !in.bad();
+        }
+
+        void work()
+        {
+            for (;;)
+            {
+                std::pair<std::string, callback_t> job;
+
+                {
+                    std::unique_lock<std::mutex> lock(m_mutex);
+
+                    m_ready.wait(lock, [this] { return m_stopped || !m_queue.empty(); });
+
+                    if (m_queue.empty())
+                    {
+                        return;
+                    }
+
+                    job = std::move(m_queue.front());
+                    m_queue.pop_front();
+                }
+
+                std::vector<std::string> lines;
+                bool result = read(job.first, lines);
+
+                job.second(result, std::move(lines));
+            }
+        }
+
+    public:
+        explicit file_source(const std::string& directory)
+            : m_directory(directory), m_worker(&file_source::work, this)
+        {
+        }
+
+        /**
+         * Finishes the queued fetches before returning
+         */
+        ~file_source()
+        {
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+
+                m_stopped = true;
+            }
+
+            m_ready.notify_one();
+            m_worker.join();
+        }
+
+        void fetch(const std::string& package, callback_t done) override
+        {
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+
+                m_queue.emplace_back(package, std::move(done));
+            }
+
+            m_ready.notify_one();
+        }
+    };
+
+    /**
+     * A source could not fetch the candidates of a package
+     */
+    class source_error : public std::runtime_error
+    {
+    public:
+        explicit source_error(const std::string& package)
+            : std::runtime_error("cannot fetch the versions of " + package)
+        {
+        }
+    };
+
+    struct requirement
+    {
+        std::string package;
+        range constraint;
+    };
+
+    /**
+     * Resolves constraints on the thread running the scheduler. The
+     * candidates of a package are fetched once, parsed on arrival, sorted
+     * from the highest and cached until invalidate(); resolutions waiting on
+     * the same package share the fetch. A failed fetch throws source_error
+     * in the resolutions waiting on it and is retried by the next one. The
+     * resolver, the scheduler and the source must outlive the coroutines.
+     */
+    class resolver
+    {
+    private:
+        struct load_awaiter;
+
+        struct entry
+        {
+            std::vector<version> versions;
+            std::vector<load_awaiter*> waiters;
+            // invalidate() bumps generation, the versions are fresh while
+            // they come from a fetch started at the current generation
+            std::size_t generation = 0;
+            std::size_t fetched = 0;
+            // generation of the last fetch started, in flight while loading
+            std::size_t requested = 0;
+            bool loading = false;
+            bool loaded = false;
+
+            bool isFresh() const
+            {
+                return loaded && fetched == generation;
+            }
+
+            /**
+             * A fetch started before invalidate() is not waited for
+             */
+            bool isLoading() const
+            {
+                return loading && requested == generation;
+            }
+        };
+
+        struct load_awaiter
+        {
+            entry& value;
+            const std::string& package;
+            std::coroutine_handle<> handle;
+            bool failed = false;
+
+            bool await_ready() const noexcept
+            {
+                return !value.isLoading() && value.isFresh();
+            }
+
+            void await_suspend(std::coroutine_handle<> suspended)
+            {
+                handle = suspended;
+                value.waiters.push_back(this);
+            }
+
+            const std::vector<version>* await_resume() const
+            {
+                if (failed)
+                {
+                    throw source_error(package);
+                }
+
+                return &value.versions;
+            }
+        };
+
+        struct join
+        {
+            std::size_t remaining;
+            std::coroutine_handle<> parent;
+            // the first failure of the children
+            std::exception_ptr error;
+        };
+
+        struct join_awaiter
+        {
+            resolver& owner;
+            const std::vector<requirement>& requirements;
+            std::vector<const version*>& results;
+            join& state;
+
+            bool await_ready() const noexcept
+            {
+                return requirements.empty();
+            }
+
+            bool await_suspend(std::coroutine_handle<> handle)
+            {
+                state.parent = handle;
+
+                for (std::size_t i = 0; i < requirements.size(); i++)
+                {
+                    owner.start(requirements[i], results[i], state);
+                }
+
+                // the extra count keeps the children that complete at once
+                // from resuming the parent before it is suspended
+                return --state.remaining != 0;
+            }
+
+            void await_resume() const noexcept
+            {
+            }
+        };
+
+        scheduler& m_scheduler;
+        source& m_source;
+        std::unordered_map<std::string, entry> m_cache;
+
+        void fetch(const std::string& package, entry& value)
+        {
+            std::size_t generation = value.generation;
+
+            value.requested = generation;
+            value.loading = true;
+            m_scheduler.expect();
+
+            m_source.fetch(package, [this, package, &value, generation](bool result, std::vector<std::string> lines) {
+                m_scheduler.complete([this, package, &value, generation, result, lines = std::move(lines)] {
+                    arrive(package, value, generation, result, lines);
+                });
+            });
+        }
+
+        void arrive(const std::string& package, entry& value, std::size_t generation, bool result, const std::vector<std::string>& lines)
+        {
+            if (generation != value.requested)
+            {
+                // a later fetch replaced this one
+                return;
+            }
+
+            value.loading = false;
+
+            if (generation != value.generation)
+            {
+                // invalidated while in flight, the waiters get a new fetch
+                if (!value.waiters.empty())
+                {
+                    fetch(package, value);
+                }
+
+                return;
+            }
+
+            if (result)
+            {
+                value.versions.clear();
+                value.versions.reserve(lines.size());
+
+                for (std::size_t i = 0; i < lines.size(); i++)
+                {
+                    version candidate(lines[i]);
+
+                    if (candidate.isValid())
+                    {
+                        value.versions.push_back(std::move(candidate));
+                    }
+                }
+
+                std::stable_sort(value.versions.begin(), value.versions.end(), [](const version& lft, const version& rgt) {
+                    return rgt < lft;
+                });
+
+                value.loaded = true;
+                value.fetched = generation;
+            }
+
+            // resumed at once, before anything else can fetch the package
+            // again and replace the versions they get
+            std::vector<load_awaiter*> waiters;
+
+            waiters.swap(value.waiters);
+
+            for (std::size_t i = 0; i < waiters.size(); i++)
+            {
+                waiters[i]->failed = !result;
+                waiters[i]->handle.resume();
+            }
+        }
+
+        detail::detached start(const requirement& value, const version*& result, join& state)
+        {
+            try
+            {
+                result = co_await resolve(value.package, value.constraint);
+            }
+            catch (...)
+            {
+                if (!state.error)
+                {
+                    state.error = std::current_exception();
+                }
+            }
+
+            if (--state.remaining == 0)
+            {
+                state.parent.resume();
+            }
+        }
+
+    public:
+        resolver(scheduler& loop, source& candidates)
+            : m_scheduler(loop), m_source(candidates)
+        {
+        }
+
+        resolver(const resolver&) = delete;
+        resolver& operator= (const resolver&) = delete;
+
+        /**
+         * Get the valid versions of a package from the highest, an unknown
+         * package has none. The pointer stays valid until the package is
+         * fetched again after invalidate().
+         */
+        task<const std::vector<version>*> candidates(std::string package)
+        {
+            entry& value = m_cache[package];
+
+            if (!value.isLoading() && !value.isFresh())
+            {
+                fetch(package, value);
+            }
+
+            co_return co_await load_awaiter { value, package };
+        }
+
+        /**
+         * Get the highest version of a package within a range, null if
+         * there is none
+         */
+        task<const version*> resolve(std::string package, range constraint)
+        {
+            const std::vector<version>* versions = co_await candidates(std::move(package));
+
+            for (const version& candidate : *versions)
+            {
+                if (constraint.contains(candidate))
+                {
+                    co_return &candidate;
+                }
+            }
+
+            co_return nullptr;
+        }
+
+        /**
+         * Resolve all the requirements concurrently, the results are in the
+         * order of the requirements. Throws the first failure once every
+         * requirement is done.
+         */
+        task<std::vector<const version*>> resolve_all(std::vector<requirement> requirements)
+        {
+            std::vector<const version*> results(requirements.size(), nullptr);
+            join state { requirements.size() + 1, nullptr, nullptr };
+
+            co_await join_awaiter { *this, requirements, results, state };
+
+            if (state.error)
+            {
+                std::rethrow_exception(state.error);
+            }
+
+            co_return results;
+        }
+
+        /**
+         * Fetch the candidates of a package again on its next resolution,
+         * a fetch in progress is not kept either. Returns false when the
+         * package was never asked for.
+         */
+        bool invalidate(const std::string& package)
+        {
+            std::unordered_map<std::string, entry>::iterator it = m_cache.find(package);
+
+            if (it == m_cache.end())
+            {
+                return false;
+            }
+
+            it->second.generation++;
+
+            return true;
+        }
+
+        /**
+         * Number of packages asked for
+         */
+        std::size_t size() const
+        {
+            return m_cache.size();
+        }
+    };
+
+    /**
+     * Run the scheduler on the calling thread until value completes
+     */
+    template <typename T>
+    T sync_wait(scheduler& loop, task<T> value)
+    {
+        T result {};
+        std::exception_ptr error;
+
+        [](task<T>& awaited, T& out, std::exception_ptr& failure) -> detail::detached {
+            try
+            {
+                out = co_await awaited;
+            }
+            catch (...)
+            {
+                failure = std::current_exception();
+            }
+        }(value, result, error);
+
+        loop.run();
+
+        if (error)
+        {
+            std::rethrow_exception(error);
+        }
+
+        return result;
+    }
+
+} // end semver namespace
+
+#endif
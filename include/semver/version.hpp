@@ -8,30 +8,31 @@
  * file that was distributed with this source code.
  */
 
-#include <cstdlib>
+#include <cstdint>
+#include <cstddef>
 #include <iostream>
-#include <sstream>
+#include <limits>
 #include <string>
+#include <semver/pre_release_table.hpp>
 
 namespace semver {
 
-    enum PRE_RELEASE {
-        PRE_RELEASE_ALPHA,
-        PRE_RELEASE_BETA,
-        PRE_RELEASE_RC,
-        PRE_RELEASE_NONE
-    };
-
-    typedef enum PRE_RELEASE pre_release_t;
+    class version_index;
+    class version_table;
 
     class version
     {
     private:
+        friend class version_index;
+        friend class version_table;
+
         std::string m_version;
-        int m_major;
-        int m_minor;
-        int m_patch;
+        std::uint64_t m_major;
+        std::uint64_t m_minor;
+        std::uint64_t m_patch;
         pre_release_t m_pre_release_type;
+        int m_pre_release_rank;
+        std::string m_pre_release_label;
         std::string m_pre_release_id;
         std::string m_pre_release;
         std::string m_build;
@@ -47,16 +48,188 @@ namespace semver {
             TYPE_BUILD
         };
 
-        void parse()
+        /**
+         * Append a decimal character to value, returns false when it is not a
+         * digit, when it would give a leading zero or when value overflows
+         */
+        static bool append_digit(std::uint64_t& value, std::size_t& digits, char chr)
+        {
+            if (chr < '0' || chr > '9' || (digits > 0 && value == 0))
+            {
+                return false;
+            }
+
+            int digit = chr - '0';
+
+            if (value > (std::numeric_limits<std::uint64_t>::max() - digit) / 10)
+            {
+                return false;
+            }
+
+            value = value * 10 + digit;
+            digits++;
+
+            return true;
+        }
+
+        static bool is_identifier_char(char chr)
+        {
+            return (chr >= '0' && chr <= '9') ||
+                (chr >= 'A' && chr <= 'Z') ||
+                (chr >= 'a' && chr <= 'z') ||
+                (chr == '-');
+        }
+
+        static bool is_numeric(const std::string& value, std::size_t begin, std::size_t end)
+        {
+            for (std::size_t i = begin; i < end; i++)
+            {
+                if (value[i] < '0' || value[i] > '9')
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        /**
+         * Check dot separated identifiers: none may be empty and, when
+         * numeric is set, numeric identifiers may not have a leading zero
+         */
+        static bool is_identifiers(const std::string& value, bool numeric)
+        {
+            std::size_t begin = 0;
+
+            for (;;)
+            {
+                std::size_t end = value.find('.', begin);
+
+                if (end == std::string::npos)
+                {
+                    end = value.length();
+                }
+
+                if (end == begin)
+                {
+                    return false;
+                }
+
+                if (numeric && end - begin > 1 && value[begin] == '0' && is_numeric(value, begin, end))
+                {
+                    return false;
+                }
+
+                if (end == value.length())
+                {
+                    return true;
+                }
+
+                begin = end + 1;
+            }
+        }
+
+        /**
+         * Compare dot separated pre-release or build identifiers, numeric
+         * identifiers compare numerically and have lower precedence than
+         * alphanumeric ones. Build identifiers may have leading zeros, equal
+         * numbers then fall back on the fewest zeros first.
+         */
+        static int compare_identifiers(const std::string& lft, const std::string& rgt)
+        {
+            std::size_t lft_begin = 0;
+            std::size_t rgt_begin = 0;
+            // first difference between numerically equal identifiers
+            int tie = 0;
+
+            for (;;)
+            {
+                bool lft_end = lft_begin > lft.length();
+                bool rgt_end = rgt_begin > rgt.length();
+
+                if (lft_end || rgt_end)
+                {
+                    return (lft_end == rgt_end) ? tie : (lft_end ? -1 : 1);
+                }
+
+                std::size_t lft_stop = lft.find('.', lft_begin);
+                std::size_t rgt_stop = rgt.find('.', rgt_begin);
+
+                if (lft_stop == std::string::npos)
+                {
+                    lft_stop = lft.length();
+                }
+
+                if (rgt_stop == std::string::npos)
+                {
+                    rgt_stop = rgt.length();
+                }
+
+                std::size_t lft_length = lft_stop - lft_begin;
+                std::size_t rgt_length = rgt_stop - rgt_begin;
+                bool lft_numeric = is_numeric(lft, lft_begin, lft_stop);
+                bool rgt_numeric = is_numeric(rgt, rgt_begin, rgt_stop);
+                int result;
+
+                if (lft_numeric != rgt_numeric)
+                {
+                    return lft_numeric ? -1 : 1;
+                }
+
+                if (lft_numeric)
+                {
+                    std::size_t lft_digits = lft_begin;
+                    std::size_t rgt_digits = rgt_begin;
+
+                    while (lft_digits < lft_stop && lft[lft_digits] == '0')
+                    {
+                        lft_digits++;
+                    }
+
+                    while (rgt_digits < rgt_stop && rgt[rgt_digits] == '0')
+                    {
+                        rgt_digits++;
+                    }
+
+                    if (tie == 0 && lft_length != rgt_length)
+                    {
+                        tie = (lft_length < rgt_length) ? -1 : 1;
+                    }
+
+                    lft_length = lft_stop - lft_digits;
+                    rgt_length = rgt_stop - rgt_digits;
+                    lft_begin = lft_digits;
+                    rgt_begin = rgt_digits;
+
+                    if (lft_length != rgt_length)
+                    {
+                        return (lft_length < rgt_length) ? -1 : 1;
+                    }
+                }
+
+                result = lft.compare(lft_begin, lft_length, rgt, rgt_begin, rgt_length);
+
+                if (result != 0)
+                {
+                    return (result < 0) ? -1 : 1;
+                }
+
+                lft_begin = lft_stop + 1;
+                rgt_begin = rgt_stop + 1;
+            }
+        }
+
+        void parse(const pre_release_table& table)
         {
             int type = TYPE_MAJOR;
 
-            std::string major, minor, patch;
+            std::uint64_t major = 0, minor = 0, patch = 0;
+            std::size_t major_digits = 0, minor_digits = 0, patch_digits = 0;
+            bool has_pre_release = false, has_build = false;
 
             for (std::size_t i = 0; i < m_version.length(); i++)
             {
                 char chr = m_version[i];
-                int chr_dec = chr;
 
                 switch (type)
                 {
@@ -68,13 +241,11 @@ namespace semver {
                             continue;
                         }
 
-                        if (chr_dec < 48 || chr_dec > 57)
+                        if (!append_digit(major, major_digits, chr))
                         {
                             m_is_valid = false;
                         }
 
-                        // major
-                        major += chr;
                         break;
 
                     case TYPE_MINOR:
@@ -85,13 +256,11 @@ namespace semver {
                             continue;
                         }
 
-                        if (chr_dec < 48 || chr_dec > 57)
+                        if (!append_digit(minor, minor_digits, chr))
                         {
                             m_is_valid = false;
                         }
 
-                        minor += chr;
-
                         break;
 
                     case TYPE_PATCH:
@@ -99,23 +268,22 @@ namespace semver {
                         if (chr == '-')
                         {
                             type = TYPE_PRE_RELEASE;
+                            has_pre_release = true;
                             continue;
                         }
 
                         if (chr == '+')
                         {
                             type = TYPE_BUILD;
+                            has_build = true;
                             continue;
                         }
 
-
-                        if (chr_dec < 48 || chr_dec > 57)
+                        if (!append_digit(patch, patch_digits, chr))
                         {
                             m_is_valid = false;
                         }
 
-                        patch += chr;
-
                         break;
 
                     case TYPE_PRE_RELEASE:
@@ -130,16 +298,11 @@ namespace semver {
                         if (chr == '+')
                         {
                             type = TYPE_BUILD;
+                            has_build = true;
                             continue;
                         }
 
-                        if (
-                            (chr_dec < 48 || chr_dec > 57) && // 0-9
-                            (chr_dec < 65 || chr_dec > 90) && // A-Z
-                            (chr_dec < 97 || chr_dec > 122) && // a-z
-                            (chr_dec != 45) && // -
-                            (chr_dec != 46) // .
-                        )
+                        if (!is_identifier_char(chr))
                         {
                             m_is_valid = false;
                         }
@@ -152,15 +315,11 @@ namespace semver {
                         if (chr == '+')
                         {
                             type = TYPE_BUILD;
+                            has_build = true;
                             continue;
                         }
 
-                        if (
-                            (chr_dec < 48 || chr_dec > 57) && // 0-9
-                            (chr_dec < 65 || chr_dec > 90) && // A-Z
-                            (chr_dec < 97 || chr_dec > 122) && // a-z
-                            (chr_dec != 45) // -
-                        )
+                        if (chr != '.' && !is_identifier_char(chr))
                         {
                             m_is_valid = false;
                         }
@@ -171,12 +330,7 @@ namespace semver {
 
                     case TYPE_BUILD:
 
-                        if (
-                            (chr_dec < 48 || chr_dec > 57) && // 0-9
-                            (chr_dec < 65 || chr_dec > 90) && // A-Z
-                            (chr_dec < 97 || chr_dec > 122) && // a-z
-                            (chr_dec != 45) // -
-                        )
+                        if (chr != '.' && !is_identifier_char(chr))
                         {
                             m_is_valid = false;
                         }
@@ -188,33 +342,43 @@ namespace semver {
 
             if (m_is_valid)
             {
-                std::istringstream(major) >> m_major;
-                std::istringstream(minor) >> m_minor;
-                std::istringstream(patch) >> m_patch;
+                m_major = major;
+                m_minor = minor;
+                m_patch = patch;
 
-                if (m_pre_release.empty())
+                if (!m_pre_release.empty())
                 {
-                    m_pre_release_type = PRE_RELEASE_NONE;
+                    m_pre_release_label = m_pre_release.substr(0, m_pre_release.find('.'));
+
+                    const pre_release_table::entry* label = table.find(m_pre_release_label);
+
+                    if (label)
+                    {
+                        m_pre_release_type = label->type;
+                        m_pre_release_rank = label->rank;
+                    }
+                    else
+                    {
+                        m_pre_release_type = PRE_RELEASE_UNKNOWN;
+                    }
                 }
-                else if (m_pre_release.find("alpha") != std::string::npos)
-                {
-                    m_pre_release_type = PRE_RELEASE_ALPHA;
-                } 
-                else if (m_pre_release.find("beta") != std::string::npos)
+
+                if (major_digits == 0 || minor_digits == 0 || patch_digits == 0)
                 {
-                    m_pre_release_type = PRE_RELEASE_BETA;
+                    m_is_valid = false;
                 }
-                else if (m_pre_release.find("rc") != std::string::npos)
+
+                if (m_major == 0 && m_minor == 0 && m_patch == 0)
                 {
-                    m_pre_release_type = PRE_RELEASE_RC;
+                    m_is_valid = false;
                 }
 
-                if (m_major == 0 && m_minor == 0 && m_patch == 0)
+                if (has_pre_release && !is_identifiers(m_pre_release, true))
                 {
                     m_is_valid = false;
                 }
 
-                if (!m_pre_release_id.empty() && m_pre_release_id[0] == '0')
+                if (has_build && !is_identifiers(m_build, false))
                 {
                     m_is_valid = false;
                 }
@@ -224,29 +388,55 @@ namespace semver {
                     m_is_stable = false;
                 }
 
-                if (m_pre_release_type != PRE_RELEASE_NONE)
+                if (!m_pre_release.empty())
                 {
                     m_is_stable = false;
                 }
             }
         }
 
+        /**
+         * Empty version, filled field by field when loading an index snapshot
+         */
+        version()
+        {
+            m_major             = 0;
+            m_minor             = 0;
+            m_patch             = 0;
+            m_pre_release_type  = PRE_RELEASE_NONE;
+            m_pre_release_rank  = pre_release_table::default_rank;
+            m_is_valid          = false;
+            m_is_stable         = false;
+        }
+
     public:
         /**
-         * Parse the version string
+         * Parse the version string, pre-release labels are ranked with table
+         */
+        version(const std::string& version, const pre_release_table& table = pre_release_table::defaults())
+            : semver::version(version.data(), version.length(), table)
+        {
+        }
+
+        /**
+         * Parse length characters from data, a line of a larger buffer
+         * needs no string of its own first
          */
-        version(const std::string& version)
+        version(const char* data, std::size_t length, const pre_release_table& table = pre_release_table::defaults())
         {
-            m_version           = version;
+            m_version.assign(data, length);
             m_major             = 0;
             m_minor             = 0;
             m_patch             = 0;
             m_build             = "";
+            m_pre_release_type  = PRE_RELEASE_NONE;
+            m_pre_release_rank  = pre_release_table::default_rank;
+            m_pre_release_label = "";
             m_pre_release       = "";
             m_pre_release_id    = "";
             m_is_stable         = true;
 
-            if (version.empty())
+            if (length == 0)
             {
                 m_is_valid = false;
             }
@@ -254,12 +444,10 @@ namespace semver {
             {
                 m_is_valid = true;
 
-                parse();
+                parse(table);
             }
         }
 
-        ~version() {}
-
         /**
          * Get full version
          */
@@ -271,7 +459,7 @@ namespace semver {
         /**
          * Get the major of the version
          */
-        const int& getMajor() const
+        const std::uint64_t& getMajor() const
         {
             return m_major;
         }
@@ -279,7 +467,7 @@ namespace semver {
         /**
          * Get the minor of the version
          */
-        const int& getMinor() const
+        const std::uint64_t& getMinor() const
         {
             return m_minor;
         }
@@ -287,7 +475,7 @@ namespace semver {
         /**
          * Get the patch of the version
          */
-        const int& getPatch() const
+        const std::uint64_t& getPatch() const
         {
             return m_patch;
         }
@@ -308,6 +496,22 @@ namespace semver {
             return m_pre_release_type;
         }
 
+        /**
+         * Get the rank of the pre-release label
+         */
+        const int& getPreReleaseRank() const
+        {
+            return m_pre_release_rank;
+        }
+
+        /**
+         * Get the release label of the version
+         */
+        const std::string& getPreReleaseLabel() const
+        {
+            return m_pre_release_label;
+        }
+
         /**
          * Get the release identifier of the version
          */
@@ -341,167 +545,112 @@ namespace semver {
         }
 
 
-        int compare(version& rgt)
+        /**
+         * Compare the precedence, build metadata ignored: -1, 0 or 1
+         */
+        int compare(const version& rgt) const
         {
-
-            if ((*this) == rgt)
-            {
-                return 0;
-            }
-
-            if ((*this) > rgt)
-            {
-                return 1;
-            }
-
-            return -1;
+            return comparePrecedence(rgt);
         }
 
-        version& operator= (version& rgt)
+        /**
+         * Compare the precedence from the parsed fields, build metadata
+         * ignored: -1, 0 or 1
+         */
+        int comparePrecedence(const version& rgt) const
         {
-            if ((*this) != rgt)
+            if (m_major != rgt.m_major)
             {
-                this->m_version             = rgt.getVersion();
-                this->m_major               = rgt.getMajor();
-                this->m_minor               = rgt.getMinor();
-                this->m_patch               = rgt.getPatch();
-                this->m_pre_release_type    = rgt.getPreReleaseType();
-                this->m_pre_release_id      = rgt.getPreReleaseId();
-                this->m_pre_release         = rgt.getPreRelease();
-                this->m_build               = rgt.getBuild();
-                this->m_is_valid            = rgt.isValid();
-                this->m_is_stable           = rgt.isStable();
+                return (m_major < rgt.m_major) ? -1 : 1;
             }
 
-            return *this;
-        }
-
-        friend bool operator== (version &lft, version &rgt)
-        {
-            return lft.getVersion().compare(rgt.getVersion()) == 0;
-        }
-
-        friend bool operator!= (version &lft, version &rgt)
-        {
-            return !(lft == rgt);
-        }
-
-        friend bool operator> (version &lft, version &rgt)
-        {
-            // Major
-            if (lft.getMajor() < 0 && rgt.getMajor() >= 0)
+            if (m_minor != rgt.m_minor)
             {
-                return false;
+                return (m_minor < rgt.m_minor) ? -1 : 1;
             }
 
-            if (lft.getMajor() >= 0 && rgt.getMajor() < 0)
+            if (m_patch != rgt.m_patch)
             {
-                return true;
+                return (m_patch < rgt.m_patch) ? -1 : 1;
             }
 
-            if (lft.getMajor() > rgt.getMajor())
+            // a release has a higher precedence than its pre-releases
+            if (m_pre_release.empty() || rgt.m_pre_release.empty())
             {
-                return true;
+                return static_cast<int>(m_pre_release.empty()) - static_cast<int>(rgt.m_pre_release.empty());
             }
 
-            if (lft.getMajor() < rgt.getMajor())
+            if (m_pre_release_rank != rgt.m_pre_release_rank)
             {
-                return false;
+                return (m_pre_release_rank < rgt.m_pre_release_rank) ? -1 : 1;
             }
 
-
-            // Minor
-            if (lft.getMinor() < 0 && rgt.getMinor() >= 0)
+            if (m_pre_release == rgt.m_pre_release)
             {
-                return false;
-            }
-
-            if (lft.getMinor() >= 0 && rgt.getMinor() < 0)
-            {
-                return true;
-            }
-
-            if (lft.getMinor() > rgt.getMinor())
-            {
-                return true;
-            }
-
-            if (lft.getMinor() < rgt.getMinor())
-            {
-                return false;
+                return 0;
             }
 
+            return compare_identifiers(m_pre_release, rgt.m_pre_release);
+        }
 
-            // Patch
-            if (lft.getPatch() < 0 && rgt.getPatch() >= 0)
-            {
-                return false;
-            }
-
-            if (lft.getPatch() >= 0 && rgt.getPatch() < 0)
+        /**
+         * Compare the build metadata with the identifier rules of the
+         * pre-release, no build first: -1, 0 or 1
+         */
+        int compareBuild(const version& rgt) const
+        {
+            if (m_build.empty() || rgt.m_build.empty())
             {
-                return true;
+                return static_cast<int>(!m_build.empty()) - static_cast<int>(!rgt.m_build.empty());
             }
 
-            if (lft.getPatch() > rgt.getPatch())
-            {
-                return true;
-            }
+            return compare_identifiers(m_build, rgt.m_build);
+        }
 
-            if (lft.getPatch() < rgt.getPatch())
-            {
-                return false;
-            }
-            
-            // Pre release
+        /**
+         * Same version, build metadata included. The parsed numbers of valid
+         * versions are compared before the strings.
+         */
+        friend bool operator== (const version& lft, const version& rgt)
+        {
             if (
-                (lft.getPreReleaseType() == rgt.getPreReleaseType()) && 
-                (lft.getPreReleaseId() == rgt.getPreReleaseId())
+                lft.m_is_valid && rgt.m_is_valid &&
+                (lft.m_major != rgt.m_major || lft.m_minor != rgt.m_minor || lft.m_patch != rgt.m_patch)
             )
             {
                 return false;
             }
 
-            if (
-                (lft.getPreReleaseId().find_first_not_of("0123456789") == std::string::npos) &&
-                (rgt.getPreReleaseId().find_first_not_of("0123456789") == std::string::npos)
-            )
-            {
-                if (atoi(lft.getPreReleaseId().c_str()) > atoi(rgt.getPreReleaseId().c_str()))
-                {
-                    return true;
-                }
-            }
-
-            if (
-                (lft.getPreReleaseType() == rgt.getPreReleaseType()) && 
-                (lft.getPreReleaseId().compare(rgt.getPreReleaseId()) > 0)
-            )
-            {
-                return true;
-            }
+            return lft.m_version == rgt.m_version;
+        }
 
-            if (lft.getPreReleaseType() > rgt.getPreReleaseType())
-            {
-                return true;
-            }
+        friend bool operator!= (const version& lft, const version& rgt)
+        {
+            return !(lft == rgt);
+        }
 
-            return false;
+        /**
+         * The ordering operators compare the precedence, so 1.0.0+a <= 1.0.0+b
+         * and 1.0.0+a >= 1.0.0+b although 1.0.0+a != 1.0.0+b
+         */
+        friend bool operator> (const version& lft, const version& rgt)
+        {
+            return lft.comparePrecedence(rgt) > 0;
         }
 
-        friend bool operator>= (version &lft, version &rgt)
+        friend bool operator>= (const version& lft, const version& rgt)
         {
-            return (lft > rgt) || (lft == rgt);
+            return lft.comparePrecedence(rgt) >= 0;
         }
 
-        friend bool operator< (version &lft, version &rgt)
+        friend bool operator< (const version& lft, const version& rgt)
         {
-            return (rgt > lft);
+            return lft.comparePrecedence(rgt) < 0;
         }
 
-        friend bool operator<= (version &lft, version &rgt)
+        friend bool operator<= (const version& lft, const version& rgt)
         {
-            return (lft < rgt) || (lft == rgt);
+            return lft.comparePrecedence(rgt) <= 0;
         }
 
         friend std::ostream& operator<< (std::ostream& out, const version& value)
@@ -0,0 +1,614 @@
+#pragma once
+/**
+ * Semver - The Semantic Versioning
+ *
+ * (c) Axel Etcheverry <axel@etcheverry.biz>
+ *
+ * For the full copyright and license information, please view the LICENSE
+ * file that was distributed with this source code.
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <iterator>
+#include <limits>
+#include <map>
+#include <string>
+#include <semver/compare.hpp>
+#include <semver/format.hpp>
+#include <semver/version.hpp>
+
+namespace semver {
+
+    /**
+     * An ordered set of valid versions answering "latest stable", "latest
+     * release of a major" and "latest pre-release of a tag" (the pre-release
+     * label, e.g. beta).
+     *
+     * Adding, removing and yanking cost O(log n). The answers are cached: a
+     * new version updates the cached answers it beats, removing or yanking a
+     * cached answer only marks it dirty and it is searched again on the next
+     * query. Yanked versions stay in the index but are never an answer.
+     *
+     * The queries fill the caches, so they are not const: concurrent
+     * readers need a lock like writers.
+     */
+    class version_index
+    {
+    private:
+        // the value is the yanked flag
+        typedef std::map<version, bool, exact_less> versions_t;
+        typedef versions_t::const_iterator iterator_t;
+
+        struct cache
+        {
+            iterator_t value;
+            bool dirty;
+        };
+
+        // format 2 adds the byte order tag
+        enum { snapshot_format = 2 };
+
+        // written in native order, reads back swapped on another byte order
+        enum { snapshot_byte_order = 0x01020304 };
+
+        versions_t m_versions;
+        cache m_latest_stable;
+        std::map<std::uint64_t, cache> m_majors;
+        std::map<std::string, cache> m_tags;
+
+        void update(cache& value, iterator_t it) const
+        {
+            if (!value.dirty && (value.value == m_versions.end() || exact_less()(value.value->first, it->first)))
+            {
+                value.value = it;
+            }
+        }
+
+        void withdraw(cache& value, iterator_t it) const
+        {
+            if (value.value == it)
+            {
+                value.value = m_versions.end();
+                value.dirty = true;
+            }
+        }
+
+        /**
+         * A version became an answer candidate
+         */
+        void offer(iterator_t it)
+        {
+            const version& value = it->first;
+
+            if (value.getPreRelease().empty())
+            {
+                std::map<std::uint64_t, cache>::iterator major = m_majors.find(value.getMajor());
+
+                if (value.isStable())
+                {
+                    update(m_latest_stable, it);
+                }
+
+                if (major != m_majors.end())
+                {
+                    update(major->second, it);
+                }
+            }
+            else
+            {
+                std::map<std::string, cache>::iterator tag = m_tags.find(value.getPreReleaseLabel());
+
+                if (tag != m_tags.end())
+                {
+                    update(tag->second, it);
+                }
+            }
+        }
+
+        /**
+         * A version stops being an answer candidate
+         */
+        void withdraw(iterator_t it)
+        {
+            const version& value = it->first;
+            std::map<std::uint64_t, cache>::iterator major = m_majors.find(value.getMajor());
+            std::map<std::string, cache>::iterator tag = m_tags.find(value.getPreReleaseLabel());
+
+            withdraw(m_latest_stable, it);
+
+            if (major != m_majors.end())
+            {
+                withdraw(major->second, it);
+            }
+
+            if (tag != m_tags.end())
+            {
+                withdraw(tag->second, it);
+            }
+        }
+
+        void reset()
+        {
+            m_latest_stable.value = m_versions.end();
+            m_latest_stable.dirty = true;
+            m_majors.clear();
+            m_tags.clear();
+        }
+
+        static const version* get(const versions_t& versions, const cache& value)
+        {
+            return (value.value == versions.end()) ? nullptr : &value.value->first;
+        }
+
+        template <typename T>
+        static void write(std::ostream& out, const T& value)
+        {
+            out.write(reinterpret_cast<const char*>(&value), sizeof(value));
+        }
+
+        template <typename T>
+        static bool read(std::istream& in, T& value)
+        {
+            return static_cast<bool>(in.read(reinterpret_cast<char*>(&value), sizeof(value)));
+        }
+
+        /**
+         * Read length bytes in blocks, a corrupt length fails at the end of
+         * the stream instead of allocating it at once
+         */
+        static bool read(std::istream& in, std::string& value, std::size_t length)
+        {
+            const std::size_t block = 4096;
+
+            value.clear();
+
+            while (value.length() < length)
+            {
+                std::size_t offset = value.length();
+                std::size_t count = std::min(block, length - offset);
+
+                value.resize(offset + count);
+
+                if (!in.read(&value[offset], count))
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        /**
+         * Same identifier rules as the parser
+         */
+        static bool is_identifiers(const std::string& value, bool numeric)
+        {
+            for (std::size_t i = 0; i < value.length(); i++)
+            {
+                if (value[i] != '.' && !version::is_identifier_char(value[i]))
+                {
+                    return false;
+                }
+            }
+
+            return version::is_identifiers(value, numeric);
+        }
+
+        /**
+         * A loaded version must be one the parser gives: the stored fields
+         * give back the stored string, which follows the grammar, and the
+         * label is ranked as table ranks it
+         */
+        static bool is_consistent(const version& value, const pre_release_table& table)
+        {
+            char buffer[256];
+            std::size_t length = value.m_version.length();
+
+            if (value.m_major == 0 && value.m_minor == 0 && value.m_patch == 0)
+            {
+                return false;
+            }
+
+            if (
+                (!value.m_pre_release.empty() && !is_identifiers(value.m_pre_release, true)) ||
+                (!value.m_build.empty() && !is_identifiers(value.m_build, false))
+            )
+            {
+                return false;
+            }
+
+            if (value.m_pre_release.empty())
+            {
+                if (value.m_pre_release_type != PRE_RELEASE_NONE || value.m_pre_release_rank != pre_release_table::default_rank)
+                {
+                    return false;
+                }
+            }
+            else
+            {
+                const pre_release_table::entry* label = table.find(value.m_pre_release_label);
+
+                if (
+                    value.m_pre_release_label != value.m_pre_release.substr(0, value.m_pre_release.find('.')) ||
+                    value.m_pre_release_type != (label ? label->type : PRE_RELEASE_UNKNOWN) ||
+                    value.m_pre_release_rank != (label ? label->rank : static_cast<int>(pre_release_table::default_rank))
+                )
+                {
+                    return false;
+                }
+            }
+
+            if (value.m_is_stable != (value.m_major > 0 && value.m_pre_release.empty()))
+            {
+                return false;
+            }
+
+            // rebuilt from the fields, the canonical format copies the string
+            std::size_t size = formatted_size(value, FORMAT_WITHOUT_BUILD);
+
+            if (size + (value.m_build.empty() ? 0 : value.m_build.length() + 1) != length)
+            {
+                return false;
+            }
+
+            if (!value.m_build.empty() && value.m_version[size] != '+')
+            {
+                return false;
+            }
+
+            if (size > sizeof(buffer))
+            {
+                return value.m_version.compare(0, size, to_string(value, FORMAT_WITHOUT_BUILD)) == 0;
+            }
+
+            to_chars(buffer, buffer + sizeof(buffer), value, FORMAT_WITHOUT_BUILD);
+
+            return value.m_version.compare(0, size, buffer, size) == 0;
+        }
+
+    public:
+        version_index()
+        {
+            m_latest_stable.value = m_versions.end();
+            m_latest_stable.dirty = false;
+        }
+
+        version_index(const version_index& rgt)
+            : m_versions(rgt.m_versions)
+        {
+            reset();
+        }
+
+        version_index& operator= (const version_index& rgt)
+        {
+            m_versions = rgt.m_versions;
+
+            reset();
+
+            return *this;
+        }
+
+        /**
+         * Add a valid version, returns false if it is invalid or already there
+         */
+        bool add(const version& value)
+        {
+            if (!value.isValid())
+            {
+                return false;
+            }
+
+            std::pair<versions_t::iterator, bool> result = m_versions.insert(std::make_pair(value, false));
+
+            if (!result.second)
+            {
+                return false;
+            }
+
+            offer(result.first);
+
+            return true;
+        }
+
+        /**
+         * Remove a version, returns false if it is not there
+         */
+        bool remove(const version& value)
+        {
+            versions_t::iterator it = m_versions.find(value);
+
+            if (it == m_versions.end())
+            {
+                return false;
+            }
+
+            withdraw(it);
+            m_versions.erase(it);
+
+            return true;
+        }
+
+        /**
+         * Keep a version but stop returning it as an answer
+         */
+        bool yank(const version& value)
+        {
+            versions_t::iterator it = m_versions.find(value);
+
+            if (it == m_versions.end() || it->second)
+            {
+                return false;
+            }
+
+            it->second = true;
+            withdraw(it);
+
+            return true;
+        }
+
+        bool unyank(const version& value)
+        {
+            versions_t::iterator it = m_versions.find(value);
+
+            if (it == m_versions.end() || !it->second)
+            {
+                return false;
+            }
+
+            it->second = false;
+            offer(it);
+
+            return true;
+        }
+
+        bool contains(const version& value) const
+        {
+            return m_versions.find(value) != m_versions.end();
+        }
+
+        bool isYanked(const version& value) const
+        {
+            iterator_t it = m_versions.find(value);
+
+            return it != m_versions.end() && it->second;
+        }
+
+        std::size_t size() const
+        {
+            return m_versions.size();
+        }
+
+        /**
+         * Get the highest stable version, null if there is none
+         */
+        const version* latestStable()
+        {
+            if (m_latest_stable.dirty)
+            {
+                m_latest_stable.value = m_versions.end();
+                m_latest_stable.dirty = false;
+
+                for (versions_t::const_reverse_iterator it = m_versions.rbegin(); it != m_versions.rend(); ++it)
+                {
+                    if (!it->second && it->first.isStable())
+                    {
+                        m_latest_stable.value = std::prev(it.base());
+                        break;
+                    }
+                }
+            }
+
+            return get(m_versions, m_latest_stable);
+        }
+
+        /**
+         * Get the highest release (no pre-release) of a major, null if there
+         * is none
+         */
+        const version* latestOfMajor(std::uint64_t major)
+        {
+            std::map<std::uint64_t, cache>::iterator value = m_majors.find(major);
+
+            if (value == m_majors.end() || value->second.dirty)
+            {
+                cache result = { m_versions.end(), false };
+                iterator_t it = m_versions.end();
+
+                if (major < std::numeric_limits<std::uint64_t>::max())
+                {
+                    it = m_versions.lower_bound(version(std::to_string(major + 1) + ".0.0-0"));
+                }
+
+                while (it != m_versions.begin())
+                {
+                    --it;
+
+                    // pre-releases ranked below -0 sort before the bound
+                    if (it->first.getMajor() > major)
+                    {
+                        continue;
+                    }
+
+                    if (it->first.getMajor() < major)
+                    {
+                        break;
+                    }
+
+                    if (!it->second && it->first.getPreRelease().empty())
+                    {
+                        result.value = it;
+                        break;
+                    }
+                }
+
+                value = m_majors.insert(std::make_pair(major, result)).first;
+                value->second = result;
+            }
+
+            return get(m_versions, value->second);
+        }
+
+        /**
+         * Get the highest pre-release labelled tag, null if there is none
+         */
+        const version* latestPreRelease(const std::string& tag)
+        {
+            std::map<std::string, cache>::iterator value = m_tags.find(tag);
+
+            if (value == m_tags.end() || value->second.dirty)
+            {
+                cache result = { m_versions.end(), false };
+
+                for (versions_t::const_reverse_iterator it = m_versions.rbegin(); it != m_versions.rend(); ++it)
+                {
+                    if (!it->second && !it->first.getPreRelease().empty() && it->first.getPreReleaseLabel() == tag)
+                    {
+                        result.value = std::prev(it.base());
+                        break;
+                    }
+                }
+
+                value = m_tags.insert(std::make_pair(tag, result)).first;
+                value->second = result;
+            }
+
+            return get(m_versions, value->second);
+        }
+
+        /**
+         * Write the parsed versions in native byte order, load() restores
+         * them without parsing
+         */
+        bool save(std::ostream& out) const
+        {
+            out.write("SEMVERIX", 8);
+            write(out, static_cast<std::uint32_t>(snapshot_format));
+            write(out, static_cast<std::uint32_t>(snapshot_byte_order));
+            write(out, static_cast<std::uint64_t>(m_versions.size()));
+
+            for (iterator_t it = m_versions.begin(); it != m_versions.end(); ++it)
+            {
+                const version& value = it->first;
+                std::uint8_t flags = (it->second ? 1 : 0) | (value.m_is_stable ? 2 : 0);
+                std::uint32_t length = static_cast<std::uint32_t>(value.m_version.length());
+                std::uint32_t pre_release = static_cast<std::uint32_t>(value.m_pre_release.length());
+                std::uint32_t label = static_cast<std::uint32_t>(value.m_pre_release_label.length());
+                std::uint32_t build = static_cast<std::uint32_t>(value.m_build.length());
+
+                write(out, flags);
+                write(out, static_cast<std::uint8_t>(value.m_pre_release_type));
+                write(out, static_cast<std::int32_t>(value.m_pre_release_rank));
+                write(out, value.m_major);
+                write(out, value.m_minor);
+                write(out, value.m_patch);
+                write(out, length);
+                write(out, pre_release);
+                write(out, label);
+                write(out, build);
+                out.write(value.m_version.data(), length);
+            }
+
+            return static_cast<bool>(out);
+        }
+
+        /**
+         * Replace the content of the index with a snapshot, the index is left
+         * untouched when the snapshot is not readable. The labels must rank
+         * as in table, the one the saved versions were parsed with.
+         */
+        bool load(std::istream& in, const pre_release_table& table = pre_release_table::defaults())
+        {
+            char magic[8];
+            std::uint32_t format = 0;
+            std::uint32_t byte_order = 0;
+            std::uint64_t count = 0;
+            versions_t versions;
+
+            if (!in.read(magic, 8) || std::memcmp(magic, "SEMVERIX", 8) != 0)
+            {
+                return false;
+            }
+
+            if (!read(in, format) || format != snapshot_format || !read(in, byte_order) || !read(in, count))
+            {
+                return false;
+            }
+
+            if (byte_order != snapshot_byte_order)
+            {
+                return false;
+            }
+
+            for (std::uint64_t i = 0; i < count; i++)
+            {
+                version value;
+                std::uint8_t flags, type;
+                std::int32_t rank;
+                std::uint32_t length, pre_release, label, build;
+
+                if (
+                    !read(in, flags) || !read(in, type) || !read(in, rank) ||
+                    !read(in, value.m_major) || !read(in, value.m_minor) || !read(in, value.m_patch) ||
+                    !read(in, length) || !read(in, pre_release) || !read(in, label) || !read(in, build)
+                )
+                {
+                    return false;
+                }
+
+                // core, "-" pre-release, "+" build
+                if (
+                    type > PRE_RELEASE_UNKNOWN || label > pre_release ||
+                    static_cast<std::uint64_t>(pre_release) + build + 2 > length
+                )
+                {
+                    return false;
+                }
+
+                if (!read(in, value.m_version, length))
+                {
+                    return false;
+                }
+
+                if (pre_release > 0)
+                {
+                    std::size_t offset = length - pre_release - (build > 0 ? build + 1 : 0);
+
+                    value.m_pre_release.assign(value.m_version, offset, pre_release);
+                    value.m_pre_release_label.assign(value.m_pre_release, 0, label);
+
+                    if (label < pre_release)
+                    {
+                        value.m_pre_release_id.assign(value.m_pre_release, label + 1, std::string::npos);
+                    }
+                }
+
+                if (build > 0)
+                {
+                    value.m_build.assign(value.m_version, length - build, build);
+                }
+
+                value.m_pre_release_type = static_cast<pre_release_t>(type);
+                value.m_pre_release_rank = rank;
+                value.m_is_valid = true;
+                value.m_is_stable = (flags & 2) != 0;
+
+                if (!is_consistent(value, table))
+                {
+                    return false;
+                }
+
+                versions.insert(versions.end(), std::make_pair(value, (flags & 1) != 0));
+            }
+
+            m_versions.swap(versions);
+
+            reset();
+
+            return true;
+        }
+    };
+
+} // end semver namespace
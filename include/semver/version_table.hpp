@@ -0,0 +1,562 @@
+#pragma once
+/**
+ * Semver - The Semantic Versioning
+ *
+ * (c) Axel Etcheverry <axel@etcheverry.biz>
+ *
+ * For the full copyright and license information, please view the LICENSE
+ * file that was distributed with this source code.
+ */
+
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <vector>
+#include <semver/version.hpp>
+
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+
+namespace semver {
+
+    /**
+     * Versions stored column by column for bulk predicates: major, minor,
+     * patch, rank and flags each live in their own contiguous array, the
+     * pre-release and build strings share one heap.
+     *
+     * Predicates return a bitmap with one bit per row. The kernels work on 64
+     * rows at a time and use AVX2 when the compiler targets it.
+     */
+    class version_table
+    {
+    public:
+        enum column_t {
+            COLUMN_MAJOR,
+            COLUMN_MINOR,
+            COLUMN_PATCH
+        };
+
+        enum compare_t {
+            COMPARE_LESS,
+            COMPARE_LESS_EQUAL,
+            COMPARE_GREATER,
+            COMPARE_GREATER_EQUAL,
+            COMPARE_EQUAL
+        };
+
+        /**
+         * One bit per row, the bits past the last row are always zero
+         */
+        class bitmap
+        {
+        private:
+            friend class version_table;
+
+            std::vector<std::uint64_t> m_words;
+            std::size_t m_size;
+
+            void trim()
+            {
+                if (m_size % 64 != 0)
+                {
+                    m_words.back() &= (std::uint64_t(1) << (m_size % 64)) - 1;
+                }
+            }
+
+        public:
+            explicit bitmap(std::size_t size = 0, bool value = false)
+                : m_words((size + 63) / 64, value ? ~std::uint64_t(0) : 0), m_size(size)
+            {
+                trim();
+            }
+
+            std::size_t size() const
+            {
+                return m_size;
+            }
+
+            /**
+             * Get the number of rows set
+             */
+            std::size_t count() const
+            {
+                std::size_t result = 0;
+
+                for (std::size_t i = 0; i < m_words.size(); i++)
+                {
+                    result += std::bitset<64>(m_words[i]).count();
+                }
+
+                return result;
+            }
+
+            bool test(std::size_t row) const
+            {
+                return (m_words[row / 64] >> (row % 64)) & 1;
+            }
+
+            const std::vector<std::uint64_t>& getWords() const
+            {
+                return m_words;
+            }
+
+            bitmap& operator&= (const bitmap& rgt)
+            {
+                for (std::size_t i = 0; i < m_words.size(); i++)
+                {
+                    m_words[i] &= rgt.m_words[i];
+                }
+
+                return *this;
+            }
+
+            bitmap& operator|= (const bitmap& rgt)
+            {
+                for (std::size_t i = 0; i < m_words.size(); i++)
+                {
+                    m_words[i] |= rgt.m_words[i];
+                }
+
+                return *this;
+            }
+
+            friend bitmap operator& (bitmap lft, const bitmap& rgt)
+            {
+                return lft &= rgt;
+            }
+
+            friend bitmap operator| (bitmap lft, const bitmap& rgt)
+            {
+                return lft |= rgt;
+            }
+
+            friend bitmap operator~ (bitmap value)
+            {
+                for (std::size_t i = 0; i < value.m_words.size(); i++)
+                {
+                    value.m_words[i] = ~value.m_words[i];
+                }
+
+                value.trim();
+
+                return value;
+            }
+        };
+
+    private:
+        enum m_flag {
+            FLAG_STABLE = 1,
+            FLAG_PRE_RELEASE = 2,
+            FLAG_BUILD = 4
+        };
+
+        std::vector<std::uint64_t> m_major;
+        std::vector<std::uint64_t> m_minor;
+        std::vector<std::uint64_t> m_patch;
+        std::vector<std::int32_t> m_rank;
+        std::vector<std::uint8_t> m_flags;
+        std::vector<std::size_t> m_offset;
+        std::vector<std::uint32_t> m_pre_release_length;
+        std::vector<std::uint32_t> m_build_length;
+        std::string m_heap;
+
+        const std::vector<std::uint64_t>& column(column_t value) const
+        {
+            return (value == COLUMN_MAJOR) ? m_major : (value == COLUMN_MINOR) ? m_minor : m_patch;
+        }
+
+        /**
+         * Bits of the rows of column less than value (equal is false) or
+         * equal to value (equal is true)
+         */
+        static bitmap scan(const std::vector<std::uint64_t>& column, std::uint64_t value, bool equal)
+        {
+            bitmap result(column.size());
+            std::size_t blocks = column.size() / 64;
+            const std::uint64_t* data = column.data();
+
+#ifdef __AVX2__
+            // unsigned order through signed compares: flip the sign bits
+            const __m256i bias = _mm256_set1_epi64x(std::numeric_limits<std::int64_t>::min());
+            const __m256i needle = equal ? _mm256_set1_epi64x(value) : _mm256_xor_si256(_mm256_set1_epi64x(value), bias);
+
+            for (std::size_t i = 0; i < blocks; i++)
+            {
+                std::uint64_t word = 0;
+
+                for (std::size_t j = 0; j < 64; j += 4)
+                {
+                    __m256i rows = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i * 64 + j));
+                    __m256i mask = equal
+                        ? _mm256_cmpeq_epi64(rows, needle)
+                        : _mm256_cmpgt_epi64(needle, _mm256_xor_si256(rows, bias));
+
+                    word |= static_cast<std::uint64_t>(_mm256_movemask_pd(_mm256_castsi256_pd(mask))) << j;
+                }
+
+                result.m_words[i] = word;
+            }
+#else
+            for (std::size_t i = 0; i < blocks; i++)
+            {
+                const std::uint64_t* rows = data + i * 64;
+                std::uint64_t word = 0;
+
+                if (equal)
+                {
+                    for (std::size_t j = 0; j < 64; j++)
+                    {
+                        word |= static_cast<std::uint64_t>(rows[j] == value) << j;
+                    }
+                }
+                else
+                {
+                    for (std::size_t j = 0; j < 64; j++)
+                    {
+                        word |= static_cast<std::uint64_t>(rows[j] < value) << j;
+                    }
+                }
+
+                result.m_words[i] = word;
+            }
+#endif
+
+            for (std::size_t row = blocks * 64; row < column.size(); row++)
+            {
+                if (equal ? (data[row] == value) : (data[row] < value))
+                {
+                    result.m_words[row / 64] |= std::uint64_t(1) << (row % 64);
+                }
+            }
+
+            return result;
+        }
+
+        /**
+         * Bits of the rows having flag set
+         */
+        bitmap scan(std::uint8_t flag) const
+        {
+            bitmap result(m_flags.size());
+            std::size_t blocks = m_flags.size() / 64;
+            const std::uint8_t* data = m_flags.data();
+
+#ifdef __AVX2__
+            const __m256i needle = _mm256_set1_epi8(static_cast<char>(flag));
+
+            for (std::size_t i = 0; i < blocks; i++)
+            {
+                __m256i low = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i * 64));
+                __m256i high = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i * 64 + 32));
+
+                low = _mm256_cmpeq_epi8(_mm256_and_si256(low, needle), needle);
+                high = _mm256_cmpeq_epi8(_mm256_and_si256(high, needle), needle);
+
+                result.m_words[i] =
+                    static_cast<std::uint64_t>(static_cast<std::uint32_t>(_mm256_movemask_epi8(low))) |
+                    (static_cast<std::uint64_t>(static_cast<std::uint32_t>(_mm256_movemask_epi8(high))) << 32);
+            }
+#else
+            for (std::size_t i = 0; i < blocks; i++)
+            {
+                const std::uint8_t* rows = data + i * 64;
+                std::uint64_t word = 0;
+
+                for (std::size_t j = 0; j < 64; j++)
+                {
+                    word |= static_cast<std::uint64_t>((rows[j] & flag) != 0) << j;
+                }
+
+                result.m_words[i] = word;
+            }
+#endif
+
+            for (std::size_t row = blocks * 64; row < m_flags.size(); row++)
+            {
+                if (data[row] & flag)
+                {
+                    result.m_words[row / 64] |= std::uint64_t(1) << (row % 64);
+                }
+            }
+
+            return result;
+        }
+
+        /**
+         * Bits of the rows whose major.minor.patch is below the one of value,
+         * same gets the rows with an equal major.minor.patch
+         */
+        bitmap below(const version& value, bitmap& same) const
+        {
+            bitmap result(size());
+            std::size_t blocks = size() / 64;
+            const std::uint64_t* major = m_major.data();
+            const std::uint64_t* minor = m_minor.data();
+            const std::uint64_t* patch = m_patch.data();
+
+            same = bitmap(size());
+
+#ifdef __AVX2__
+            const __m256i bias = _mm256_set1_epi64x(std::numeric_limits<std::int64_t>::min());
+            const __m256i major_value = _mm256_set1_epi64x(value.getMajor());
+            const __m256i minor_value = _mm256_set1_epi64x(value.getMinor());
+            const __m256i patch_value = _mm256_set1_epi64x(value.getPatch());
+
+            for (std::size_t i = 0; i < blocks; i++)
+            {
+                std::uint64_t below_word = 0;
+                std::uint64_t same_word = 0;
+
+                for (std::size_t j = 0; j < 64; j += 4)
+                {
+                    std::size_t row = i * 64 + j;
+                    __m256i major_rows = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(major + row));
+                    __m256i minor_rows = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(minor + row));
+                    __m256i patch_rows = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(patch + row));
+
+                    __m256i major_equal = _mm256_cmpeq_epi64(major_rows, major_value);
+                    __m256i minor_equal = _mm256_cmpeq_epi64(minor_rows, minor_value);
+                    __m256i patch_equal = _mm256_cmpeq_epi64(patch_rows, patch_value);
+                    __m256i major_less = _mm256_cmpgt_epi64(_mm256_xor_si256(major_value, bias), _mm256_xor_si256(major_rows, bias));
+                    __m256i minor_less = _mm256_cmpgt_epi64(_mm256_xor_si256(minor_value, bias), _mm256_xor_si256(minor_rows, bias));
+                    __m256i patch_less = _mm256_cmpgt_epi64(_mm256_xor_si256(patch_value, bias), _mm256_xor_si256(patch_rows, bias));
+
+                    __m256i less = _mm256_or_si256(major_less, _mm256_and_si256(major_equal,
+                        _mm256_or_si256(minor_less, _mm256_and_si256(minor_equal, patch_less))));
+                    __m256i equal = _mm256_and_si256(major_equal, _mm256_and_si256(minor_equal, patch_equal));
+
+                    below_word |= static_cast<std::uint64_t>(_mm256_movemask_pd(_mm256_castsi256_pd(less))) << j;
+                    same_word |= static_cast<std::uint64_t>(_mm256_movemask_pd(_mm256_castsi256_pd(equal))) << j;
+                }
+
+                result.m_words[i] = below_word;
+                same.m_words[i] = same_word;
+            }
+#else
+            for (std::size_t i = 0; i < blocks; i++)
+            {
+                std::uint64_t below_word = 0;
+                std::uint64_t same_word = 0;
+
+                for (std::size_t j = 0; j < 64; j++)
+                {
+                    std::size_t row = i * 64 + j;
+                    bool major_equal = major[row] == value.getMajor();
+                    bool minor_equal = minor[row] == value.getMinor();
+                    bool less = (major[row] < value.getMajor()) | (major_equal &
+                        ((minor[row] < value.getMinor()) | (minor_equal & (patch[row] < value.getPatch()))));
+
+                    below_word |= static_cast<std::uint64_t>(less) << j;
+                    same_word |= static_cast<std::uint64_t>(major_equal & minor_equal & (patch[row] == value.getPatch())) << j;
+                }
+
+                result.m_words[i] = below_word;
+                same.m_words[i] = same_word;
+            }
+#endif
+
+            for (std::size_t row = blocks * 64; row < size(); row++)
+            {
+                bool major_equal = major[row] == value.getMajor();
+                bool minor_equal = minor[row] == value.getMinor();
+
+                if ((major[row] < value.getMajor()) || (major_equal && ((minor[row] < value.getMinor()) || (minor_equal && patch[row] < value.getPatch()))))
+                {
+                    result.m_words[row / 64] |= std::uint64_t(1) << (row % 64);
+                }
+
+                if (major_equal && minor_equal && patch[row] == value.getPatch())
+                {
+                    same.m_words[row / 64] |= std::uint64_t(1) << (row % 64);
+                }
+            }
+
+            return result;
+        }
+
+        /**
+         * Compare the pre-release of a row with the one of a version sharing
+         * its major.minor.patch
+         */
+        int compare(std::size_t row, const version& value) const
+        {
+            bool pre_release = (m_flags[row] & FLAG_PRE_RELEASE) != 0;
+
+            if (!pre_release || value.getPreRelease().empty())
+            {
+                return (int) !pre_release - (int) value.getPreRelease().empty();
+            }
+
+            if (m_rank[row] != value.getPreReleaseRank())
+            {
+                return (m_rank[row] < value.getPreReleaseRank()) ? -1 : 1;
+            }
+
+            return version::compare_identifiers(getPreRelease(row), value.getPreRelease());
+        }
+
+    public:
+        void reserve(std::size_t size)
+        {
+            m_major.reserve(size);
+            m_minor.reserve(size);
+            m_patch.reserve(size);
+            m_rank.reserve(size);
+            m_flags.reserve(size);
+            m_offset.reserve(size);
+            m_pre_release_length.reserve(size);
+            m_build_length.reserve(size);
+        }
+
+        /**
+         * Append a valid version, returns false if it is invalid
+         */
+        bool add(const version& value)
+        {
+            if (!value.isValid())
+            {
+                return false;
+            }
+
+            std::uint8_t flags = 0;
+
+            flags |= value.isStable() ? FLAG_STABLE : 0;
+            flags |= value.getPreRelease().empty() ? 0 : FLAG_PRE_RELEASE;
+            flags |= value.getBuild().empty() ? 0 : FLAG_BUILD;
+
+            m_major.push_back(value.getMajor());
+            m_minor.push_back(value.getMinor());
+            m_patch.push_back(value.getPatch());
+            m_rank.push_back(value.getPreReleaseRank());
+            m_flags.push_back(flags);
+            m_offset.push_back(m_heap.size());
+            m_pre_release_length.push_back(static_cast<std::uint32_t>(value.getPreRelease().length()));
+            m_build_length.push_back(static_cast<std::uint32_t>(value.getBuild().length()));
+            m_heap += value.getPreRelease();
+            m_heap += value.getBuild();
+
+            return true;
+        }
+
+        std::size_t size() const
+        {
+            return m_major.size();
+        }
+
+        const std::uint64_t& getMajor(std::size_t row) const
+        {
+            return m_major[row];
+        }
+
+        const std::uint64_t& getMinor(std::size_t row) const
+        {
+            return m_minor[row];
+        }
+
+        const std::uint64_t& getPatch(std::size_t row) const
+        {
+            return m_patch[row];
+        }
+
+        std::string getPreRelease(std::size_t row) const
+        {
+            return m_heap.substr(m_offset[row], m_pre_release_length[row]);
+        }
+
+        std::string getBuild(std::size_t row) const
+        {
+            return m_heap.substr(m_offset[row] + m_pre_release_length[row], m_build_length[row]);
+        }
+
+        bool isStable(std::size_t row) const
+        {
+            return (m_flags[row] & FLAG_STABLE) != 0;
+        }
+
+        /**
+         * Rows whose component compares to value
+         */
+        bitmap select(column_t component, compare_t op, std::uint64_t value) const
+        {
+            const std::vector<std::uint64_t>& rows = column(component);
+
+            switch (op)
+            {
+                case COMPARE_LESS:
+                    return scan(rows, value, false);
+
+                case COMPARE_LESS_EQUAL:
+                    return scan(rows, value, false) | scan(rows, value, true);
+
+                case COMPARE_GREATER:
+                    return ~(scan(rows, value, false) | scan(rows, value, true));
+
+                case COMPARE_GREATER_EQUAL:
+                    return ~scan(rows, value, false);
+
+                default:
+                    return scan(rows, value, true);
+            }
+        }
+
+        /**
+         * Rows of stable versions
+         */
+        bitmap stable() const
+        {
+            return scan(FLAG_STABLE);
+        }
+
+        /**
+         * Rows of pre-release versions
+         */
+        bitmap preRelease() const
+        {
+            return scan(FLAG_PRE_RELEASE);
+        }
+
+        /**
+         * Rows with low <= version < high in precedence order
+         */
+        bitmap between(const version& low, const version& high) const
+        {
+            bitmap low_same, high_same;
+            bitmap low_below = below(low, low_same);
+            bitmap high_below = below(high, high_same);
+            bitmap result = ~low_below & high_below;
+
+            // rows sharing major.minor.patch with a bound, usually a few
+            for (std::size_t i = 0; i < result.m_words.size(); i++)
+            {
+                std::uint64_t same = low_same.m_words[i] | high_same.m_words[i];
+
+                for (std::size_t bit = 0; same != 0; bit++, same >>= 1)
+                {
+                    if (!(same & 1))
+                    {
+                        continue;
+                    }
+
+                    std::size_t row = i * 64 + bit;
+                    bool above_low = low_same.test(row) ? compare(row, low) >= 0 : !low_below.test(row);
+                    bool below_high = high_same.test(row) ? compare(row, high) < 0 : high_below.test(row);
+
+                    if (above_low && below_high)
+                    {
+                        result.m_words[i] |= std::uint64_t(1) << bit;
+                    }
+                    else
+                    {
+                        result.m_words[i] &= ~(std::uint64_t(1) << bit);
+                    }
+                }
+            }
+
+            return result;
+        }
+    };
+
+} // end semver namespace
@@ -0,0 +1,32 @@
+/**
+ * Semver - The Semantic Versioning
+ *
+ * (c) Axel Etcheverry <axel@etcheverry.biz>
+ *
+ * For the full copyright and license information, please view the LICENSE
+ * file that was distributed with this source code.
+ */
+
+// nothing but the semver header, it must bring std::formatter on its own
+#include <semver/format.hpp>
+#include <boost/test/unit_test.hpp>
+
+#if defined(__cpp_lib_format)
+
+BOOST_AUTO_TEST_SUITE(semver_std_format)
+
+BOOST_AUTO_TEST_CASE(test_std_format)
+{
+    semver::version value("1.2.3-rc.1+build.5");
+
+    BOOST_CHECK_EQUAL(std::format("{}", value), "1.2.3-rc.1+build.5");
+    BOOST_CHECK_EQUAL(std::format("{:c}", value), "1.2.3-rc.1+build.5");
+    BOOST_CHECK_EQUAL(std::format("{:p}", value), "1.2.3-rc.1");
+    BOOST_CHECK_EQUAL(std::format("v{:m}.x", value), "v1.2.x");
+    BOOST_CHECK_EQUAL(std::format("{}", semver::version("a.b.c")), "a.b.c");
+    BOOST_CHECK_THROW(static_cast<void>(std::vformat("{:q}", std::make_format_args(value))), std::format_error);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif
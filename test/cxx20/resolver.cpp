@@ -0,0 +1,288 @@
+/**
+ * Semver - The Semantic Versioning
+ *
+ * (c) Axel Etcheverry <axel@etcheverry.biz>
+ *
+ * For the full copyright and license information, please view the LICENSE
+ * file that was distributed with this source code.
+ */
+
+#include <boost/test/unit_test.hpp>
+#include <semver/resolver.hpp>
+
+#if defined(__cpp_impl_coroutine)
+
+#include <cstdio>
+#include <fstream>
+#include <stdlib.h>
+#include <unistd.h>
+
+namespace {
+
+    class counting_source : public semver::memory_source
+    {
+    public:
+        std::size_t fetches = 0;
+
+        void fetch(const std::string& package, callback_t done) override
+        {
+            fetches++;
+
+            semver::memory_source::fetch(package, std::move(done));
+        }
+    };
+
+    /**
+     * Fails the first fetches of every package
+     */
+    class flaky_source : public semver::memory_source
+    {
+    public:
+        std::size_t failures = 0;
+
+        void fetch(const std::string& package, callback_t done) override
+        {
+            if (failures > 0)
+            {
+                failures--;
+                done(false, std::vector<std::string>());
+
+                return;
+            }
+
+            semver::memory_source::fetch(package, std::move(done));
+        }
+    };
+
+    /**
+     * Copies the versions when fetched and completes on the next turn of
+     * the loop
+     */
+    class deferred_source : public semver::memory_source
+    {
+    private:
+        semver::scheduler& m_loop;
+
+    public:
+        std::size_t fetches = 0;
+
+        explicit deferred_source(semver::scheduler& loop)
+            : m_loop(loop)
+        {
+        }
+
+        void fetch(const std::string& package, callback_t done) override
+        {
+            fetches++;
+
+            semver::memory_source::fetch(package, [this, done](bool result, std::vector<std::string> lines) {
+                m_loop.post([done, result, lines] {
+                    done(result, lines);
+                });
+            });
+        }
+    };
+
+    semver::detail::detached resolve_into(semver::task<const semver::version*> value, const semver::version*& result)
+    {
+        result = co_await value;
+    }
+
+    std::string get(const semver::version* value)
+    {
+        return value ? value->getVersion() : "none";
+    }
+
+}
+
+BOOST_AUTO_TEST_SUITE(semver_resolver)
+
+BOOST_AUTO_TEST_CASE(test_resolve)
+{
+    semver::scheduler loop;
+    semver::memory_source source;
+    semver::resolver resolver(loop, source);
+
+    source
+        .add("foo", "1.0.0")
+        .add("foo", "1.4.2")
+        .add("foo", "2.0.0-rc.1")
+        .add("foo", "not a version")
+        .add("foo", "1.10.0");
+
+    BOOST_CHECK_EQUAL(get(semver::sync_wait(loop, resolver.resolve("foo", semver::range("^1.0.0")))), "1.10.0");
+    BOOST_CHECK_EQUAL(get(semver::sync_wait(loop, resolver.resolve("foo", semver::range("~1.4.0")))), "1.4.2");
+    BOOST_CHECK_EQUAL(get(semver::sync_wait(loop, resolver.resolve("foo", semver::range("^3.0.0")))), "none");
+    BOOST_CHECK_EQUAL(get(semver::sync_wait(loop, resolver.resolve("bar", semver::range("*")))), "none");
+
+    const std::vector<semver::version>* versions = semver::sync_wait(loop, resolver.candidates("foo"));
+
+    BOOST_REQUIRE_EQUAL(versions->size(), 4u);
+    BOOST_CHECK_EQUAL((*versions)[0].getVersion(), "2.0.0-rc.1");
+    BOOST_CHECK_EQUAL((*versions)[3].getVersion(), "1.0.0");
+    BOOST_CHECK_EQUAL(resolver.size(), 2u);
+}
+
+BOOST_AUTO_TEST_CASE(test_resolve_all)
+{
+    semver::scheduler loop;
+    counting_source source;
+    semver::resolver resolver(loop, source);
+    std::vector<semver::requirement> requirements;
+
+    source.add("foo", "1.0.0").add("foo", "2.1.0").add("bar", "0.3.1");
+
+    for (int i = 0; i < 100; i++)
+    {
+        requirements.push_back({ "foo", semver::range((i % 2) ? "^1.0.0" : "^2.0.0") });
+        requirements.push_back({ "bar", semver::range("^0.3.0") });
+    }
+
+    requirements.push_back({ "baz", semver::range("*") });
+
+    std::vector<const semver::version*> results = semver::sync_wait(loop, resolver.resolve_all(requirements));
+
+    BOOST_REQUIRE_EQUAL(results.size(), 201u);
+    BOOST_CHECK_EQUAL(get(results[0]), "2.1.0");
+    BOOST_CHECK_EQUAL(get(results[1]), "0.3.1");
+    BOOST_CHECK_EQUAL(get(results[2]), "1.0.0");
+    BOOST_CHECK_EQUAL(get(results[200]), "none");
+
+    // concurrent resolutions of a package share one fetch
+    BOOST_CHECK_EQUAL(source.fetches, 3u);
+
+    results = semver::sync_wait(loop, resolver.resolve_all(requirements));
+
+    BOOST_CHECK_EQUAL(get(results[199]), "0.3.1");
+    BOOST_CHECK_EQUAL(source.fetches, 3u);
+    BOOST_CHECK_EQUAL(semver::sync_wait(loop, resolver.resolve_all({})).size(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(test_failure)
+{
+    semver::scheduler loop;
+    flaky_source source;
+    semver::resolver resolver(loop, source);
+    std::vector<semver::requirement> requirements;
+
+    source.add("foo", "1.0.0").add("bar", "2.0.0");
+    source.failures = 1;
+
+    for (int i = 0; i < 10; i++)
+    {
+        requirements.push_back({ "foo", semver::range("*") });
+        requirements.push_back({ "bar", semver::range("*") });
+    }
+
+    // the other requirements still complete before the failure is thrown
+    BOOST_CHECK_THROW(semver::sync_wait(loop, resolver.resolve_all(requirements)), semver::source_error);
+
+    // the failed fetch is not cached
+    std::vector<const semver::version*> results = semver::sync_wait(loop, resolver.resolve_all(requirements));
+
+    BOOST_CHECK_EQUAL(get(results[0]), "1.0.0");
+    BOOST_CHECK_EQUAL(get(results[19]), "2.0.0");
+}
+
+BOOST_AUTO_TEST_CASE(test_invalidate)
+{
+    semver::scheduler loop;
+    counting_source source;
+    semver::resolver resolver(loop, source);
+
+    source.add("foo", "1.0.0");
+
+    BOOST_CHECK_EQUAL(resolver.invalidate("foo"), false);
+    BOOST_CHECK_EQUAL(get(semver::sync_wait(loop, resolver.resolve("foo", semver::range("*")))), "1.0.0");
+
+    source.add("foo", "1.1.0");
+
+    BOOST_CHECK_EQUAL(get(semver::sync_wait(loop, resolver.resolve("foo", semver::range("*")))), "1.0.0");
+    BOOST_CHECK_EQUAL(source.fetches, 1u);
+    BOOST_CHECK_EQUAL(resolver.invalidate("foo"), true);
+    BOOST_CHECK_EQUAL(get(semver::sync_wait(loop, resolver.resolve("foo", semver::range("*")))), "1.1.0");
+    BOOST_CHECK_EQUAL(source.fetches, 2u);
+}
+
+BOOST_AUTO_TEST_CASE(test_invalidate_in_flight)
+{
+    semver::scheduler loop;
+    deferred_source source(loop);
+    semver::resolver resolver(loop, source);
+    const semver::version* later = nullptr;
+
+    source.add("foo", "1.0.0");
+
+    // runs before the fetch of the first resolution completes
+    loop.post([&] {
+        source.add("foo", "2.0.0");
+        resolver.invalidate("foo");
+    });
+
+    BOOST_CHECK_EQUAL(get(semver::sync_wait(loop, resolver.resolve("foo", semver::range("*")))), "2.0.0");
+    BOOST_CHECK_EQUAL(source.fetches, 2u);
+
+    source.add("foo", "3.0.0");
+    resolver.invalidate("foo");
+
+    // a resolution started after invalidate() does not join the stale fetch
+    loop.post([&] {
+        source.add("foo", "4.0.0");
+        resolver.invalidate("foo");
+        resolve_into(resolver.resolve("foo", semver::range("*")), later);
+    });
+
+    BOOST_CHECK_EQUAL(get(semver::sync_wait(loop, resolver.resolve("foo", semver::range("*")))), "4.0.0");
+    BOOST_CHECK_EQUAL(get(later), "4.0.0");
+    BOOST_CHECK_EQUAL(source.fetches, 4u);
+}
+
+BOOST_AUTO_TEST_CASE(test_file_source)
+{
+    char directory[] = "/tmp/semver-resolver-XXXXXX";
+
+    BOOST_REQUIRE(mkdtemp(directory) != nullptr);
+
+    std::ofstream(std::string(directory) + "/foo") << "1.0.0\r\n1.2.0\n\n2.0.0\n";
+    std::ofstream(std::string(directory) + "/bar") << "0.1.0\n";
+
+    {
+        semver::scheduler loop;
+        semver::file_source source(directory);
+        semver::resolver resolver(loop, source);
+
+        std::vector<const semver::version*> results = semver::sync_wait(loop, resolver.resolve_all({
+            { "foo", semver::range("^1.0.0") },
+            { "bar", semver::range("*") },
+            { "foo", semver::range(">=2.0.0") },
+            { "../foo", semver::range("*") }
+        }));
+
+        BOOST_CHECK_EQUAL(get(results[0]), "1.2.0");
+        BOOST_CHECK_EQUAL(get(results[1]), "0.1.0");
+        BOOST_CHECK_EQUAL(get(results[2]), "2.0.0");
+        BOOST_CHECK_EQUAL(get(results[3]), "none");
+
+        // a missing file is a failure, not an empty package
+        BOOST_CHECK_THROW(semver::sync_wait(loop, resolver.resolve("baz", semver::range("*"))), semver::source_error);
+
+        std::ofstream(std::string(directory) + "/baz") << "3.0.0\n";
+
+        BOOST_CHECK_EQUAL(get(semver::sync_wait(loop, resolver.resolve("baz", semver::range("*")))), "3.0.0");
+
+        std::ofstream(std::string(directory) + "/baz", std::ios::app) << "3.1.0\n";
+
+        BOOST_CHECK_EQUAL(get(semver::sync_wait(loop, resolver.resolve("baz", semver::range("*")))), "3.0.0");
+        BOOST_CHECK_EQUAL(resolver.invalidate("baz"), true);
+        BOOST_CHECK_EQUAL(get(semver::sync_wait(loop, resolver.resolve("baz", semver::range("*")))), "3.1.0");
+    }
+
+    std::remove((std::string(directory) + "/baz").c_str());
+    std::remove((std::string(directory) + "/foo").c_str());
+    std::remove((std::string(directory) + "/bar").c_str());
+    rmdir(directory);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif
@@ -0,0 +1,98 @@
+/**
+ * Semver - The Semantic Versioning
+ *
+ * (c) Axel Etcheverry <axel@etcheverry.biz>
+ *
+ * For the full copyright and license information, please view the LICENSE
+ * file that was distributed with this source code.
+ */
+
+#include <algorithm>
+#include <set>
+#include <vector>
+#include <boost/test/unit_test.hpp>
+#include <semver/compare.hpp>
+
+static int compare(const std::string& lft, const std::string& rgt, semver::comparison_t mode)
+{
+    return semver::compare(semver::version(lft), semver::version(rgt), mode);
+}
+
+BOOST_AUTO_TEST_SUITE(semver_compare)
+
+BOOST_AUTO_TEST_CASE(test_precedence)
+{
+    BOOST_CHECK_EQUAL(compare("1.0.0+a", "1.0.0+b", semver::COMPARISON_PRECEDENCE), 0);
+    BOOST_CHECK_EQUAL(compare("1.0.0", "1.0.0+b", semver::COMPARISON_PRECEDENCE), 0);
+    BOOST_CHECK_EQUAL(compare("1.0.0-rc.1+b", "1.0.0+a", semver::COMPARISON_PRECEDENCE), -1);
+    BOOST_CHECK_EQUAL(compare("1.0.10", "1.0.9", semver::COMPARISON_PRECEDENCE), 1);
+}
+
+BOOST_AUTO_TEST_CASE(test_build)
+{
+    BOOST_CHECK_EQUAL(compare("1.0.0+a", "1.0.0+b", semver::COMPARISON_BUILD), -1);
+    BOOST_CHECK_EQUAL(compare("1.0.0", "1.0.0+a", semver::COMPARISON_BUILD), -1);
+    BOOST_CHECK_EQUAL(compare("1.0.0+build.10", "1.0.0+build.9", semver::COMPARISON_BUILD), 1);
+    BOOST_CHECK_EQUAL(compare("1.0.0+build.9", "1.0.0+build.9", semver::COMPARISON_BUILD), 0);
+    BOOST_CHECK_EQUAL(compare("1.0.1+a", "1.0.0+b", semver::COMPARISON_BUILD), 1);
+
+    // build identifiers may have leading zeros
+    BOOST_CHECK_EQUAL(compare("1.0.0+001", "1.0.0+02", semver::COMPARISON_BUILD), -1);
+    BOOST_CHECK_EQUAL(compare("1.0.0+0009", "1.0.0+10", semver::COMPARISON_BUILD), -1);
+    BOOST_CHECK_EQUAL(compare("1.0.0+10", "1.0.0+0009", semver::COMPARISON_BUILD), 1);
+    BOOST_CHECK_EQUAL(compare("1.0.0+000", "1.0.0+1", semver::COMPARISON_BUILD), -1);
+    BOOST_CHECK_EQUAL(compare("1.0.0+01", "1.0.0+1", semver::COMPARISON_BUILD), 1);
+    BOOST_CHECK_EQUAL(compare("1.0.0+1", "1.0.0+01", semver::COMPARISON_BUILD), -1);
+    BOOST_CHECK_EQUAL(compare("1.0.0+01.b", "1.0.0+1.a", semver::COMPARISON_BUILD), 1);
+    BOOST_CHECK_EQUAL(compare("1.0.0+01.1", "1.0.0+1.2", semver::COMPARISON_BUILD), -1);
+    BOOST_CHECK_EQUAL(compare("1.0.0+007", "1.0.0+007", semver::COMPARISON_BUILD), 0);
+}
+
+BOOST_AUTO_TEST_CASE(test_exact)
+{
+    BOOST_CHECK_EQUAL(compare("1.0.0+build.10", "1.0.0+build.9", semver::COMPARISON_EXACT), -1);
+    BOOST_CHECK_EQUAL(compare("1.0.0+a", "1.0.0+a", semver::COMPARISON_EXACT), 0);
+    BOOST_CHECK_EQUAL(compare("a.b.c", "0.0.1", semver::COMPARISON_EXACT), -1);
+    BOOST_CHECK_EQUAL(compare("a.b.c", "x.y.z", semver::COMPARISON_EXACT), -1);
+    BOOST_CHECK_EQUAL(compare("a.b.c", "a.b.c", semver::COMPARISON_EXACT), 0);
+
+    // invalid versions are all equivalent by precedence
+    BOOST_CHECK_EQUAL(compare("a.b.c", "x.y.z", semver::COMPARISON_PRECEDENCE), 0);
+}
+
+BOOST_AUTO_TEST_CASE(test_containers)
+{
+    std::vector<semver::version> versions;
+    const char* values[] = { "1.0.0+b", "1.0.0-rc.1", "1.0.0+a", "0.9.0", "1.0.0", "1.0.0+a" };
+
+    for (std::size_t i = 0; i < sizeof(values) / sizeof(values[0]); i++)
+    {
+        versions.push_back(semver::version(values[i]));
+    }
+
+    std::sort(versions.begin(), versions.end(), semver::exact_less());
+
+    BOOST_CHECK_EQUAL(versions[0].getVersion(), "0.9.0");
+    BOOST_CHECK_EQUAL(versions[1].getVersion(), "1.0.0-rc.1");
+    BOOST_CHECK_EQUAL(versions[2].getVersion(), "1.0.0");
+    BOOST_CHECK_EQUAL(versions[3].getVersion(), "1.0.0+a");
+    BOOST_CHECK_EQUAL(versions[5].getVersion(), "1.0.0+b");
+
+    std::vector<semver::version> unique(versions);
+
+    unique.erase(std::unique(unique.begin(), unique.end(), semver::exact_equal()), unique.end());
+
+    BOOST_CHECK_EQUAL(unique.size(), 5u);
+
+    unique.erase(std::unique(unique.begin(), unique.end(), semver::precedence_equal()), unique.end());
+
+    BOOST_CHECK_EQUAL(unique.size(), 3u);
+
+    std::set<semver::version, semver::precedence_less> precedences(versions.begin(), versions.end());
+    std::set<semver::version, semver::build_less> builds(versions.begin(), versions.end());
+
+    BOOST_CHECK_EQUAL(precedences.size(), 3u);
+    BOOST_CHECK_EQUAL(builds.size(), 5u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,77 @@
+/**
+ * Semver - The Semantic Versioning
+ *
+ * (c) Axel Etcheverry <axel@etcheverry.biz>
+ *
+ * For the full copyright and license information, please view the LICENSE
+ * file that was distributed with this source code.
+ */
+
+#include <boost/test/unit_test.hpp>
+#include "../../fuzz/differential.hpp"
+
+BOOST_AUTO_TEST_SUITE(semver_differential)
+
+BOOST_AUTO_TEST_CASE(test_reference_grammar)
+{
+    const char* const valid[] = {
+        "1.0.0-alpha.1.2", "1.0.0-alpha.beta.1", "1.0.0-alpha.0", "1.0.0-0a.00a",
+        "1.0.0+build.1", "1.0.0+001", "1.0.0-x-y.z+0.build-1", "0.1.0", "1.0.0--"
+    };
+
+    const char* const invalid[] = {
+        "1", "1.2", "1..2", ".1.2", "1.2.", "1.2.3.4", "01.2.3", "1.02.3", "1.2.03",
+        "1.0.0-", "1.0.0+", "1.0.0-a..b", "1.0.0-.a", "1.0.0-a.", "1.0.0+a..b",
+        "1.0.0-01", "1.0.0-alpha.1.01", "1.0.0-a+b+c", "1.0.0-a_b", "1.0.0 ",
+        "0.0.0", "18446744073709551616.0.0"
+    };
+
+    for (std::size_t i = 0; i < sizeof(valid) / sizeof(valid[0]); i++)
+    {
+        BOOST_CHECK_MESSAGE(semver::version(valid[i]).isValid(), valid[i]);
+        BOOST_CHECK_EQUAL(semver_differential::check_parse(valid[i]), "");
+    }
+
+    for (std::size_t i = 0; i < sizeof(invalid) / sizeof(invalid[0]); i++)
+    {
+        BOOST_CHECK_MESSAGE(!semver::version(invalid[i]).isValid(), invalid[i]);
+        BOOST_CHECK_EQUAL(semver_differential::check_parse(invalid[i]), "");
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_reference_precedence)
+{
+    const char* const ordered[] = {
+        "1.0.0-0", "1.0.0-1", "1.0.0-2", "1.0.0-10", "1.0.0-99999999999999999999",
+        "1.0.0-A", "1.0.0-alpha", "1.0.0-alpha.1", "1.0.0-alpha.1.2", "1.0.0-alpha.1.10",
+        "1.0.0-alpha.beta", "1.0.0-beta", "1.0.0-beta.2", "1.0.0-beta.11", "1.0.0-dev",
+        "1.0.0-rc.1", "1.0.0", "1.0.1", "1.1.0", "2.0.0"
+    };
+
+    std::size_t count = sizeof(ordered) / sizeof(ordered[0]);
+
+    for (std::size_t i = 0; i < count; i++)
+    {
+        for (std::size_t j = 0; j < count; j++)
+        {
+            BOOST_CHECK_EQUAL(semver_differential::check_compare(ordered[i], ordered[j]), "");
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_generated)
+{
+    semver_differential::generator generator(0);
+
+    for (int i = 0; i < 100000; i++)
+    {
+        std::string left = generator.next();
+        std::string right = generator.next(left);
+
+        BOOST_REQUIRE_EQUAL(semver_differential::check_parse(left), "");
+        BOOST_REQUIRE_EQUAL(semver_differential::check_parse(right), "");
+        BOOST_REQUIRE_EQUAL(semver_differential::check_compare(left, right), "");
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,89 @@
+/**
+ * Semver - The Semantic Versioning
+ *
+ * (c) Axel Etcheverry <axel@etcheverry.biz>
+ *
+ * For the full copyright and license information, please view the LICENSE
+ * file that was distributed with this source code.
+ */
+
+#include <boost/test/unit_test.hpp>
+#include <semver/format.hpp>
+
+#if defined(SEMVER_TEST_FMT)
+#include <semver/fmt.hpp>
+#endif
+
+static std::string format(const std::string& value, semver::format_t format = semver::FORMAT_CANONICAL)
+{
+    return semver::to_string(semver::version(value), format);
+}
+
+BOOST_AUTO_TEST_SUITE(semver_format)
+
+BOOST_AUTO_TEST_CASE(test_formats)
+{
+    BOOST_CHECK_EQUAL(format("1.2.3"), "1.2.3");
+    BOOST_CHECK_EQUAL(format("1.2.3-beta.11+20130101133700"), "1.2.3-beta.11+20130101133700");
+    BOOST_CHECK_EQUAL(format("1.2.3-beta.11+20130101133700", semver::FORMAT_WITHOUT_BUILD), "1.2.3-beta.11");
+    BOOST_CHECK_EQUAL(format("1.2.3+build", semver::FORMAT_WITHOUT_BUILD), "1.2.3");
+    BOOST_CHECK_EQUAL(format("1.2.3-rc.1+build", semver::FORMAT_MAJOR_MINOR), "1.2");
+    BOOST_CHECK_EQUAL(format("10.0.99"), "10.0.99");
+    BOOST_CHECK_EQUAL(
+        format("18446744073709551615.10000000000000000000.9999999999999999999"),
+        "18446744073709551615.10000000000000000000.9999999999999999999"
+    );
+}
+
+BOOST_AUTO_TEST_CASE(test_invalid)
+{
+    BOOST_CHECK_EQUAL(format("a.b.c"), "a.b.c");
+    BOOST_CHECK_EQUAL(format("1.0", semver::FORMAT_MAJOR_MINOR), "1.0");
+    BOOST_CHECK_EQUAL(format(""), "");
+}
+
+BOOST_AUTO_TEST_CASE(test_to_chars)
+{
+    semver::version value("1.22.333-alpha+001");
+    char buffer[32];
+
+    semver::to_chars_result result = semver::to_chars(buffer, buffer + sizeof(buffer), value);
+
+    BOOST_CHECK(result.ec == std::errc());
+    BOOST_CHECK_EQUAL(std::string(buffer, result.ptr), "1.22.333-alpha+001");
+    BOOST_CHECK_EQUAL(semver::formatted_size(value), 18u);
+
+    result = semver::to_chars(buffer, buffer + 17, value);
+
+    BOOST_CHECK(result.ec == std::errc::value_too_large);
+    BOOST_CHECK(result.ptr == buffer + 17);
+
+    result = semver::to_chars(buffer, buffer + 8, value, semver::FORMAT_MAJOR_MINOR);
+
+    BOOST_CHECK(result.ec == std::errc());
+    BOOST_CHECK_EQUAL(std::string(buffer, result.ptr), "1.22");
+}
+
+BOOST_AUTO_TEST_CASE(test_format_to)
+{
+    std::string out;
+
+    semver::format_to(std::back_inserter(out), semver::version("2.0.0-rc.1+sha.5114f85"), semver::FORMAT_WITHOUT_BUILD);
+
+    BOOST_CHECK_EQUAL(out, "2.0.0-rc.1");
+}
+
+#if defined(SEMVER_TEST_FMT)
+BOOST_AUTO_TEST_CASE(test_fmt)
+{
+    semver::version value("1.2.3-rc.1+build.5");
+
+    BOOST_CHECK_EQUAL(fmt::format("{}", value), "1.2.3-rc.1+build.5");
+    BOOST_CHECK_EQUAL(fmt::format("{:c}", value), "1.2.3-rc.1+build.5");
+    BOOST_CHECK_EQUAL(fmt::format("{:p}", value), "1.2.3-rc.1");
+    BOOST_CHECK_EQUAL(fmt::format("v{:m}.x", value), "v1.2.x");
+    BOOST_CHECK_THROW(fmt::format(fmt::runtime("{:q}"), value), fmt::format_error);
+}
+#endif
+
+BOOST_AUTO_TEST_SUITE_END()
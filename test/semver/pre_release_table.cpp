@@ -0,0 +1,126 @@
+/**
+ * Semver - The Semantic Versioning
+ *
+ * (c) Axel Etcheverry <axel@etcheverry.biz>
+ *
+ * For the full copyright and license information, please view the LICENSE
+ * file that was distributed with this source code.
+ */
+
+#include <boost/test/unit_test.hpp>
+#include <semver/version.hpp>
+
+BOOST_AUTO_TEST_SUITE(semver_pre_release_table)
+
+BOOST_AUTO_TEST_CASE(test_default_table)
+{
+    const semver::pre_release_table& table = semver::pre_release_table::defaults();
+
+    BOOST_CHECK_EQUAL(table.size(), 3);
+    BOOST_REQUIRE(table.find("alpha") != nullptr);
+    BOOST_CHECK_EQUAL(table.find("alpha")->type, semver::PRE_RELEASE_ALPHA);
+    BOOST_REQUIRE(table.find("beta") != nullptr);
+    BOOST_CHECK_EQUAL(table.find("beta")->type, semver::PRE_RELEASE_BETA);
+    BOOST_REQUIRE(table.find("rc") != nullptr);
+    BOOST_CHECK_EQUAL(table.find("rc")->type, semver::PRE_RELEASE_RC);
+    BOOST_CHECK(table.find("r") == nullptr);
+    BOOST_CHECK(table.find("rc1") == nullptr);
+    BOOST_CHECK(table.find("") == nullptr);
+    BOOST_CHECK_EQUAL(table.rank("gamma"), static_cast<int>(semver::pre_release_table::default_rank));
+}
+
+BOOST_AUTO_TEST_CASE(test_add)
+{
+    semver::pre_release_table table;
+
+    BOOST_CHECK_EQUAL(table.size(), 0);
+    BOOST_CHECK(table.find("dev") == nullptr);
+
+    table.add("dev", -3).add("pre", -2).add("milestone", -1).add("SNAPSHOT", -4);
+
+    BOOST_CHECK_EQUAL(table.size(), 4);
+    BOOST_CHECK_EQUAL(table.rank("dev"), -3);
+    BOOST_CHECK_EQUAL(table.rank("pre"), -2);
+    BOOST_CHECK_EQUAL(table.rank("milestone"), -1);
+    BOOST_CHECK_EQUAL(table.rank("SNAPSHOT"), -4);
+    BOOST_CHECK_EQUAL(table.find("dev")->type, semver::PRE_RELEASE_UNKNOWN);
+
+    table.add("dev", 5);
+
+    BOOST_CHECK_EQUAL(table.size(), 4);
+    BOOST_CHECK_EQUAL(table.rank("dev"), 5);
+}
+
+BOOST_AUTO_TEST_CASE(test_many_labels)
+{
+    semver::pre_release_table table;
+
+    for (int i = 0; i < 200; i++)
+    {
+        table.add("label" + std::to_string(i), i);
+    }
+
+    BOOST_CHECK_EQUAL(table.size(), 200);
+
+    for (int i = 0; i < 200; i++)
+    {
+        BOOST_CHECK_EQUAL(table.rank("label" + std::to_string(i)), i);
+    }
+
+    BOOST_CHECK(table.find("label200") == nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(test_version_type)
+{
+    semver::version version("1.0.0-rc-beta.1");
+
+    BOOST_CHECK_EQUAL(version.getPreReleaseLabel(), "rc-beta");
+    BOOST_CHECK_EQUAL(version.getPreReleaseType(), semver::PRE_RELEASE_UNKNOWN);
+    BOOST_CHECK_EQUAL(version.isStable(), false);
+
+    semver::version version1("1.0.0-alpha.beta");
+
+    BOOST_CHECK_EQUAL(version1.getPreReleaseLabel(), "alpha");
+    BOOST_CHECK_EQUAL(version1.getPreReleaseType(), semver::PRE_RELEASE_ALPHA);
+
+    semver::version version2("1.0.0");
+
+    BOOST_CHECK_EQUAL(version2.getPreReleaseLabel(), "");
+    BOOST_CHECK_EQUAL(version2.getPreReleaseType(), semver::PRE_RELEASE_NONE);
+}
+
+BOOST_AUTO_TEST_CASE(test_version_rank)
+{
+    semver::pre_release_table table;
+
+    table.add("SNAPSHOT", -4).add("dev", -3).add("pre", -2).add("milestone", -1);
+
+    semver::version snapshot("1.0.0-SNAPSHOT", table);
+    semver::version dev("1.0.0-dev.2", table);
+    semver::version pre("1.0.0-pre", table);
+    semver::version milestone("1.0.0-milestone.1", table);
+    semver::version milestone2("1.0.0-milestone.2", table);
+    semver::version alpha("1.0.0-alpha", table);
+    semver::version rc("1.0.0-rc.1", table);
+    semver::version release("1.0.0", table);
+
+    BOOST_CHECK_EQUAL(dev.getPreReleaseRank(), -3);
+    BOOST_CHECK_EQUAL(alpha.getPreReleaseRank(), static_cast<int>(semver::pre_release_table::default_rank));
+
+    BOOST_CHECK_EQUAL(snapshot < dev, true);
+    BOOST_CHECK_EQUAL(dev < pre, true);
+    BOOST_CHECK_EQUAL(pre < milestone, true);
+    BOOST_CHECK_EQUAL(milestone < milestone2, true);
+    BOOST_CHECK_EQUAL(milestone2 < alpha, true);
+    BOOST_CHECK_EQUAL(alpha < rc, true);
+    BOOST_CHECK_EQUAL(rc < release, true);
+    BOOST_CHECK_EQUAL(release < snapshot, false);
+
+    // with the default table "dev" is an ordinary identifier
+    semver::version dev1("1.0.0-dev.2");
+    semver::version alpha1("1.0.0-alpha");
+
+    BOOST_CHECK_EQUAL(alpha1 < dev1, true);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,91 @@
+/**
+ * Semver - The Semantic Versioning
+ *
+ * (c) Axel Etcheverry <axel@etcheverry.biz>
+ *
+ * For the full copyright and license information, please view the LICENSE
+ * file that was distributed with this source code.
+ */
+
+#include <boost/test/unit_test.hpp>
+#include <semver/range.hpp>
+
+static bool contains(const std::string& range, const std::string& version)
+{
+    return semver::range(range).contains(semver::version(version));
+}
+
+BOOST_AUTO_TEST_SUITE(semver_range)
+
+BOOST_AUTO_TEST_CASE(test_comparators)
+{
+    BOOST_CHECK_EQUAL(contains(">1.2.3", "1.2.4"), true);
+    BOOST_CHECK_EQUAL(contains(">1.2.3", "1.2.3"), false);
+    BOOST_CHECK_EQUAL(contains(">=1.2.3", "1.2.3"), true);
+    BOOST_CHECK_EQUAL(contains(">=1.2.3", "1.2.3-rc.1"), false);
+    BOOST_CHECK_EQUAL(contains("<1.2.3", "1.2.3-rc.1"), true);
+    BOOST_CHECK_EQUAL(contains("<1.2.3", "1.2.3"), false);
+    BOOST_CHECK_EQUAL(contains("<=1.2.3", "1.2.3+build"), true);
+    BOOST_CHECK_EQUAL(contains("=1.2.3", "1.2.3"), true);
+    BOOST_CHECK_EQUAL(contains("1.2.3", "1.2.3+build"), true);
+    BOOST_CHECK_EQUAL(contains("1.2.3", "1.2.4"), false);
+    BOOST_CHECK_EQUAL(contains(">= 1.0.0 < 2.0.0", "1.5.0"), true);
+    BOOST_CHECK_EQUAL(contains(">=1.0.0 <2.0.0", "2.0.0"), false);
+    BOOST_CHECK_EQUAL(contains("*", "0.0.1"), true);
+    BOOST_CHECK_EQUAL(contains("*", "a.b.c"), false);
+}
+
+BOOST_AUTO_TEST_CASE(test_caret_tilde)
+{
+    BOOST_CHECK_EQUAL(contains("^1.2.3", "1.9.0"), true);
+    BOOST_CHECK_EQUAL(contains("^1.2.3", "2.0.0-alpha"), false);
+    BOOST_CHECK_EQUAL(contains("^1.2.3", "1.2.2"), false);
+    BOOST_CHECK_EQUAL(contains("^0.2.3", "0.2.9"), true);
+    BOOST_CHECK_EQUAL(contains("^0.2.3", "0.3.0"), false);
+    BOOST_CHECK_EQUAL(contains("^0.0.3", "0.0.3"), true);
+    BOOST_CHECK_EQUAL(contains("^0.0.3", "0.0.4"), false);
+    BOOST_CHECK_EQUAL(contains("~1.2.3", "1.2.9"), true);
+    BOOST_CHECK_EQUAL(contains("~1.2.3", "1.3.0"), false);
+    BOOST_CHECK_EQUAL(contains("^18446744073709551615.0.0", "18446744073709551615.1.0"), true);
+}
+
+BOOST_AUTO_TEST_CASE(test_custom_ranks)
+{
+    semver::pre_release_table table;
+
+    table.add("SNAPSHOT", -1).add("alpha", 1);
+
+    BOOST_CHECK_EQUAL(semver::range("^1.2.3").contains(semver::version("2.0.0-SNAPSHOT", table)), false);
+    BOOST_CHECK_EQUAL(semver::range("~1.2.3").contains(semver::version("1.3.0-SNAPSHOT", table)), false);
+    BOOST_CHECK_EQUAL(semver::range("^0.2.3").contains(semver::version("0.3.0-SNAPSHOT", table)), false);
+    BOOST_CHECK_EQUAL(semver::range("^0.0.3").contains(semver::version("0.0.4-SNAPSHOT", table)), false);
+    BOOST_CHECK_EQUAL(semver::range("^1.2.3").contains(semver::version("2.0.0-0", table)), false);
+    BOOST_CHECK_EQUAL(semver::range("^1.2.3").contains(semver::version("1.9.9", table)), true);
+    BOOST_CHECK_EQUAL(semver::range("~1.2.3").contains(semver::version("1.2.4-alpha", table)), true);
+}
+
+BOOST_AUTO_TEST_CASE(test_or)
+{
+    BOOST_CHECK_EQUAL(contains("^1.0.0 || ^3.0.0", "1.1.0"), true);
+    BOOST_CHECK_EQUAL(contains("^1.0.0 || ^3.0.0", "2.1.0"), false);
+    BOOST_CHECK_EQUAL(contains("^1.0.0 || ^3.0.0", "3.1.0"), true);
+}
+
+BOOST_AUTO_TEST_CASE(test_invalid)
+{
+    BOOST_CHECK_EQUAL(semver::range("^1.0.0").isValid(), true);
+    BOOST_CHECK_EQUAL(semver::range("^1.0").isValid(), false);
+    BOOST_CHECK_EQUAL(semver::range(">= || 1.0.0").isValid(), false);
+    BOOST_CHECK_EQUAL(semver::range(">=").isValid(), false);
+    BOOST_CHECK_EQUAL(semver::range("foo").isValid(), false);
+    BOOST_CHECK_EQUAL(semver::range("").isValid(), false);
+    BOOST_CHECK_EQUAL(semver::range("  ").isValid(), false);
+    BOOST_CHECK_EQUAL(semver::range("||").isValid(), false);
+    BOOST_CHECK_EQUAL(semver::range("^1.0.0 ||").isValid(), false);
+    BOOST_CHECK_EQUAL(semver::range("|| ^1.0.0").isValid(), false);
+    BOOST_CHECK_EQUAL(semver::range("* || ^1.0.0").isValid(), true);
+    BOOST_CHECK_EQUAL(contains("||", "1.0.0"), false);
+    BOOST_CHECK_EQUAL(contains("foo", "1.0.0"), false);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -40,6 +40,27 @@ BOOST_AUTO_TEST_CASE(test_simple_version)
     BOOST_CHECK_EQUAL(version1.getBuild(), "");
 }
 
+BOOST_AUTO_TEST_CASE(test_buffer_version)
+{
+    const char buffer[] = "1.2.3-beta.1+build\n2.0.0\n";
+
+    semver::version version(buffer, 18);
+
+    BOOST_CHECK_EQUAL(version.isValid(), true);
+    BOOST_CHECK_EQUAL(version.getVersion(), "1.2.3-beta.1+build");
+    BOOST_CHECK_EQUAL(version.getPreRelease(), "beta.1");
+    BOOST_CHECK_EQUAL(version.getBuild(), "build");
+    BOOST_CHECK(version == semver::version("1.2.3-beta.1+build"));
+
+    semver::version version1(buffer + 19, 5);
+
+    BOOST_CHECK_EQUAL(version1.isValid(), true);
+    BOOST_CHECK_EQUAL(version1.getVersion(), "2.0.0");
+
+    BOOST_CHECK_EQUAL(semver::version(buffer + 19, 0).isValid(), false);
+    BOOST_CHECK_EQUAL(semver::version(buffer + 19, 6).isValid(), false);
+}
+
 BOOST_AUTO_TEST_CASE(test_simple_error_version)
 {
     semver::version version("a.b.c");
@@ -216,6 +237,51 @@ BOOST_AUTO_TEST_CASE(test_build_version)
     BOOST_CHECK_EQUAL(version3.getBuild(), "20130101133700-foo");
 }
 
+BOOST_AUTO_TEST_CASE(test_large_version)
+{
+    semver::version version("20261019.1.0");
+
+    BOOST_CHECK_EQUAL(version.isValid(), true);
+    BOOST_CHECK_EQUAL(version.getMajor(), 20261019u);
+    BOOST_CHECK_EQUAL(version.getMinor(), 1u);
+    BOOST_CHECK_EQUAL(version.getPatch(), 0u);
+
+    semver::version version1("1.0.4294967296");
+
+    BOOST_CHECK_EQUAL(version1.isValid(), true);
+    BOOST_CHECK_EQUAL(version1.getPatch(), 4294967296ull);
+
+    semver::version version2("18446744073709551615.18446744073709551615.18446744073709551615");
+
+    BOOST_CHECK_EQUAL(version2.isValid(), true);
+    BOOST_CHECK_EQUAL(version2.getMajor(), 18446744073709551615ull);
+    BOOST_CHECK_EQUAL(version2.getMinor(), 18446744073709551615ull);
+    BOOST_CHECK_EQUAL(version2.getPatch(), 18446744073709551615ull);
+
+    semver::version version3("1.0.4294967297");
+
+    BOOST_CHECK_EQUAL(version3 > version1, true);
+    BOOST_CHECK_EQUAL(version1 < version3, true);
+}
+
+BOOST_AUTO_TEST_CASE(test_overflow_version)
+{
+    semver::version version("18446744073709551616.0.0");
+
+    BOOST_CHECK_EQUAL(version.isValid(), false);
+    BOOST_CHECK_EQUAL(version.getMajor(), 0u);
+
+    semver::version version1("1.99999999999999999999.0");
+
+    BOOST_CHECK_EQUAL(version1.isValid(), false);
+    BOOST_CHECK_EQUAL(version1.getMinor(), 0u);
+
+    semver::version version2("1.0.18446744073709551620-beta");
+
+    BOOST_CHECK_EQUAL(version2.isValid(), false);
+    BOOST_CHECK_EQUAL(version2.getPatch(), 0u);
+}
+
 BOOST_AUTO_TEST_CASE(test_compare)
 {
     semver::version version("1.2.3");
@@ -231,6 +297,14 @@ BOOST_AUTO_TEST_CASE(test_compare)
     BOOST_CHECK_EQUAL(version2.compare(version3), -1);
 
     BOOST_CHECK_EQUAL(version3.compare(version2), 1);
+
+    semver::version version4("1.2.3+a");
+
+    semver::version version5("1.2.3+b");
+
+    BOOST_CHECK_EQUAL(version4.compare(version5), 0);
+
+    BOOST_CHECK_EQUAL(version4.compareBuild(version5), -1);
 }
 
 BOOST_AUTO_TEST_CASE(test_assignment)
@@ -325,6 +399,18 @@ BOOST_AUTO_TEST_CASE(test_comparator)
     semver::version version20("1.2.4-beta.1");
 
     BOOST_CHECK_EQUAL(version20 > version19, true);
+
+    semver::version version21("1.2.3+a");
+
+    semver::version version22("1.2.3+b");
+
+    BOOST_CHECK_EQUAL(version21 == version22, false);
+    BOOST_CHECK_EQUAL(version21 >= version22, true);
+    BOOST_CHECK_EQUAL(version21 <= version22, true);
+    BOOST_CHECK_EQUAL(version21 > version22, false);
+    BOOST_CHECK_EQUAL(version21 == semver::version("1.2.3+a"), true);
+    BOOST_CHECK_EQUAL(semver::version("a.b.c") == semver::version("x.y.z"), false);
+    BOOST_CHECK_EQUAL(semver::version("a.b.c") == semver::version("a.b.c"), true);
 }
 
 BOOST_AUTO_TEST_CASE(test_comparator_suite)
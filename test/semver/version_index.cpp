@@ -0,0 +1,209 @@
+/**
+ * Semver - The Semantic Versioning
+ *
+ * (c) Axel Etcheverry <axel@etcheverry.biz>
+ *
+ * For the full copyright and license information, please view the LICENSE
+ * file that was distributed with this source code.
+ */
+
+#include <algorithm>
+#include <sstream>
+#include <boost/test/unit_test.hpp>
+#include <semver/version_index.hpp>
+
+static std::string str(const semver::version* value)
+{
+    return value ? value->getVersion() : "(null)";
+}
+
+BOOST_AUTO_TEST_SUITE(semver_version_index)
+
+BOOST_AUTO_TEST_CASE(test_add)
+{
+    semver::version_index index;
+
+    BOOST_CHECK_EQUAL(str(index.latestStable()), "(null)");
+    BOOST_CHECK_EQUAL(index.add(semver::version("1.0.0")), true);
+    BOOST_CHECK_EQUAL(index.add(semver::version("1.0.0")), false);
+    BOOST_CHECK_EQUAL(index.add(semver::version("a.b.c")), false);
+    BOOST_CHECK_EQUAL(index.add(semver::version("1.0.0+build")), true);
+    BOOST_CHECK_EQUAL(index.size(), 2);
+    BOOST_CHECK_EQUAL(str(index.latestStable()), "1.0.0+build");
+
+    index.add(semver::version("0.9.0"));
+    index.add(semver::version("2.0.0-beta.1"));
+
+    BOOST_CHECK_EQUAL(str(index.latestStable()), "1.0.0+build");
+    BOOST_CHECK_EQUAL(str(index.latestOfMajor(0)), "0.9.0");
+    BOOST_CHECK_EQUAL(str(index.latestOfMajor(2)), "(null)");
+    BOOST_CHECK_EQUAL(str(index.latestPreRelease("beta")), "2.0.0-beta.1");
+    BOOST_CHECK_EQUAL(str(index.latestPreRelease("rc")), "(null)");
+
+    // cached answers follow new versions
+    index.add(semver::version("2.0.0"));
+    index.add(semver::version("2.0.0-beta.2"));
+    index.add(semver::version("0.9.1"));
+
+    BOOST_CHECK_EQUAL(str(index.latestStable()), "2.0.0");
+    BOOST_CHECK_EQUAL(str(index.latestOfMajor(0)), "0.9.1");
+    BOOST_CHECK_EQUAL(str(index.latestOfMajor(2)), "2.0.0");
+    BOOST_CHECK_EQUAL(str(index.latestPreRelease("beta")), "2.0.0-beta.2");
+}
+
+BOOST_AUTO_TEST_CASE(test_remove_yank)
+{
+    semver::version_index index;
+
+    index.add(semver::version("1.0.0"));
+    index.add(semver::version("1.1.0"));
+    index.add(semver::version("1.2.0-rc.1"));
+    index.add(semver::version("1.2.0-rc.2"));
+
+    BOOST_CHECK_EQUAL(str(index.latestStable()), "1.1.0");
+    BOOST_CHECK_EQUAL(str(index.latestOfMajor(1)), "1.1.0");
+    BOOST_CHECK_EQUAL(str(index.latestPreRelease("rc")), "1.2.0-rc.2");
+
+    BOOST_CHECK_EQUAL(index.yank(semver::version("1.1.0")), true);
+    BOOST_CHECK_EQUAL(index.yank(semver::version("1.1.0")), false);
+    BOOST_CHECK_EQUAL(index.isYanked(semver::version("1.1.0")), true);
+    BOOST_CHECK_EQUAL(index.contains(semver::version("1.1.0")), true);
+    BOOST_CHECK_EQUAL(str(index.latestStable()), "1.0.0");
+    BOOST_CHECK_EQUAL(str(index.latestOfMajor(1)), "1.0.0");
+
+    BOOST_CHECK_EQUAL(index.unyank(semver::version("1.1.0")), true);
+    BOOST_CHECK_EQUAL(str(index.latestStable()), "1.1.0");
+    BOOST_CHECK_EQUAL(str(index.latestOfMajor(1)), "1.1.0");
+
+    BOOST_CHECK_EQUAL(index.remove(semver::version("1.2.0-rc.2")), true);
+    BOOST_CHECK_EQUAL(index.remove(semver::version("1.2.0-rc.2")), false);
+    BOOST_CHECK_EQUAL(str(index.latestPreRelease("rc")), "1.2.0-rc.1");
+
+    index.remove(semver::version("1.2.0-rc.1"));
+
+    BOOST_CHECK_EQUAL(str(index.latestPreRelease("rc")), "(null)");
+    BOOST_CHECK_EQUAL(index.size(), 2);
+}
+
+BOOST_AUTO_TEST_CASE(test_major_ranked_pre_release)
+{
+    semver::pre_release_table table;
+
+    table.add("SNAPSHOT", -1);
+
+    semver::version_index index;
+
+    index.add(semver::version("1.5.0", table));
+    index.add(semver::version("2.0.0-SNAPSHOT", table));
+
+    BOOST_CHECK_EQUAL(str(index.latestOfMajor(1)), "1.5.0");
+    BOOST_CHECK_EQUAL(str(index.latestPreRelease("SNAPSHOT")), "2.0.0-SNAPSHOT");
+}
+
+BOOST_AUTO_TEST_CASE(test_snapshot)
+{
+    semver::version_index index;
+
+    index.add(semver::version("1.0.0"));
+    index.add(semver::version("1.1.0-beta.2+exp.sha.5114f85"));
+    index.add(semver::version("1.1.0+20130101133700"));
+    index.add(semver::version("0.1.0"));
+    index.yank(semver::version("1.1.0+20130101133700"));
+
+    std::stringstream stream;
+
+    BOOST_REQUIRE(index.save(stream));
+
+    semver::version_index loaded;
+
+    BOOST_REQUIRE(loaded.load(stream));
+    BOOST_CHECK_EQUAL(loaded.size(), 4);
+    BOOST_CHECK_EQUAL(loaded.isYanked(semver::version("1.1.0+20130101133700")), true);
+    BOOST_CHECK_EQUAL(str(loaded.latestStable()), "1.0.0");
+    BOOST_CHECK_EQUAL(str(loaded.latestOfMajor(0)), "0.1.0");
+
+    const semver::version* beta = loaded.latestPreRelease("beta");
+
+    BOOST_REQUIRE(beta != nullptr);
+    BOOST_CHECK_EQUAL(beta->getVersion(), "1.1.0-beta.2+exp.sha.5114f85");
+    BOOST_CHECK_EQUAL(beta->isValid(), true);
+    BOOST_CHECK_EQUAL(beta->isStable(), false);
+    BOOST_CHECK_EQUAL(beta->getMajor(), 1u);
+    BOOST_CHECK_EQUAL(beta->getMinor(), 1u);
+    BOOST_CHECK_EQUAL(beta->getPatch(), 0u);
+    BOOST_CHECK_EQUAL(beta->getPreRelease(), "beta.2");
+    BOOST_CHECK_EQUAL(beta->getPreReleaseLabel(), "beta");
+    BOOST_CHECK_EQUAL(beta->getPreReleaseId(), "2");
+    BOOST_CHECK_EQUAL(beta->getPreReleaseType(), semver::PRE_RELEASE_BETA);
+    BOOST_CHECK_EQUAL(beta->getBuild(), "exp.sha.5114f85");
+
+    std::stringstream broken("SEMVERIX");
+
+    BOOST_CHECK_EQUAL(loaded.load(broken), false);
+    BOOST_CHECK_EQUAL(loaded.size(), 4);
+}
+
+BOOST_AUTO_TEST_CASE(test_snapshot_corrupt)
+{
+    semver::version_index index;
+    semver::version_index loaded;
+    std::stringstream stream;
+
+    index.add(semver::version("12.3.4-rc.1+b"));
+
+    BOOST_REQUIRE(index.save(stream));
+
+    // magic, format, byte order, count, then flags, type, rank, major
+    const std::string snapshot = stream.str();
+    const std::size_t byte_order = 12;
+    const std::size_t major = 30;
+    const std::size_t length = major + 24;
+    std::string value;
+
+    BOOST_REQUIRE_EQUAL(snapshot.size(), length + 16 + 13);
+
+    std::stringstream valid(snapshot);
+
+    BOOST_CHECK_EQUAL(loaded.load(valid), true);
+
+    value = snapshot;
+    std::reverse(value.begin() + byte_order, value.begin() + byte_order + 4);
+    std::stringstream swapped(value);
+
+    BOOST_CHECK_EQUAL(loaded.load(swapped), false);
+
+    value = snapshot;
+    value[major] = 13;
+    std::stringstream numbers(value);
+
+    BOOST_CHECK_EQUAL(loaded.load(numbers), false);
+
+    // "12.3.4-rc.!+b" formats back to itself but does not parse
+    value = snapshot;
+    value[length + 16 + 10] = '!';
+    std::stringstream grammar(value);
+
+    BOOST_CHECK_EQUAL(loaded.load(grammar), false);
+
+    // rc is ranked otherwise by the table the snapshot is loaded with
+    semver::pre_release_table table = semver::pre_release_table::defaults();
+    std::stringstream ranked(snapshot);
+
+    table.add("rc", 5, semver::PRE_RELEASE_RC);
+
+    BOOST_CHECK_EQUAL(loaded.load(ranked, table), false);
+
+    value = snapshot;
+    value[length + 3] = '\x7f';
+    std::stringstream huge(value);
+
+    BOOST_CHECK_EQUAL(loaded.load(huge), false);
+
+    std::stringstream truncated(snapshot.substr(0, snapshot.size() - 1));
+
+    BOOST_CHECK_EQUAL(loaded.load(truncated), false);
+    BOOST_CHECK_EQUAL(loaded.size(), 1u);
+    BOOST_CHECK_EQUAL(str(loaded.latestPreRelease("rc")), "12.3.4-rc.1+b");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
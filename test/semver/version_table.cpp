@@ -0,0 +1,122 @@
+/**
+ * Semver - The Semantic Versioning
+ *
+ * (c) Axel Etcheverry <axel@etcheverry.biz>
+ *
+ * For the full copyright and license information, please view the LICENSE
+ * file that was distributed with this source code.
+ */
+
+#include <random>
+#include <vector>
+#include <boost/test/unit_test.hpp>
+#include <semver/version_table.hpp>
+
+static std::vector<semver::version> generate(std::size_t count)
+{
+    static const char* const pre_releases[] = { "", "", "", "-alpha", "-alpha.1", "-beta.2", "-rc.1", "-0" };
+    static const char* const builds[] = { "", "", "+build.7", "+001" };
+
+    std::mt19937_64 random(count);
+    std::vector<semver::version> versions;
+
+    while (versions.size() < count)
+    {
+        semver::version value(
+            std::to_string(random() % 4) + "." + std::to_string(random() % 3) + "." + std::to_string(random() % 3) +
+            pre_releases[random() % 8] + builds[random() % 4]
+        );
+
+        if (value.isValid())
+        {
+            versions.push_back(value);
+        }
+    }
+
+    return versions;
+}
+
+BOOST_AUTO_TEST_SUITE(semver_version_table)
+
+BOOST_AUTO_TEST_CASE(test_columns)
+{
+    semver::version_table table;
+
+    BOOST_CHECK_EQUAL(table.add(semver::version("1.2.3-beta.1+build")), true);
+    BOOST_CHECK_EQUAL(table.add(semver::version("a.b.c")), false);
+    BOOST_CHECK_EQUAL(table.add(semver::version("18446744073709551615.0.1")), true);
+    BOOST_CHECK_EQUAL(table.size(), 2);
+    BOOST_CHECK_EQUAL(table.getMajor(0), 1u);
+    BOOST_CHECK_EQUAL(table.getMinor(0), 2u);
+    BOOST_CHECK_EQUAL(table.getPatch(0), 3u);
+    BOOST_CHECK_EQUAL(table.getPreRelease(0), "beta.1");
+    BOOST_CHECK_EQUAL(table.getBuild(0), "build");
+    BOOST_CHECK_EQUAL(table.isStable(0), false);
+    BOOST_CHECK_EQUAL(table.getMajor(1), 18446744073709551615ull);
+    BOOST_CHECK_EQUAL(table.getPreRelease(1), "");
+    BOOST_CHECK_EQUAL(table.isStable(1), true);
+
+    semver::version_table::bitmap huge = table.select(semver::version_table::COLUMN_MAJOR, semver::version_table::COMPARE_GREATER, 1);
+
+    BOOST_CHECK_EQUAL(huge.count(), 1);
+    BOOST_CHECK_EQUAL(huge.test(1), true);
+}
+
+BOOST_AUTO_TEST_CASE(test_bitmap)
+{
+    semver::version_table::bitmap all(70, true);
+    semver::version_table::bitmap none(70);
+
+    BOOST_CHECK_EQUAL(all.count(), 70);
+    BOOST_CHECK_EQUAL(none.count(), 0);
+    BOOST_CHECK_EQUAL((~none).count(), 70);
+    BOOST_CHECK_EQUAL((~all).count(), 0);
+    BOOST_CHECK_EQUAL((all & none).count(), 0);
+    BOOST_CHECK_EQUAL((all | none).count(), 70);
+}
+
+BOOST_AUTO_TEST_CASE(test_predicates)
+{
+    const std::size_t sizes[] = { 0, 1, 63, 64, 65, 1000 };
+
+    for (std::size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++)
+    {
+        std::vector<semver::version> versions = generate(sizes[s]);
+        semver::version_table table;
+
+        for (std::size_t i = 0; i < versions.size(); i++)
+        {
+            table.add(versions[i]);
+        }
+
+        semver::version_table::bitmap less = table.select(semver::version_table::COLUMN_MAJOR, semver::version_table::COMPARE_LESS, 2);
+        semver::version_table::bitmap less_equal = table.select(semver::version_table::COLUMN_MINOR, semver::version_table::COMPARE_LESS_EQUAL, 1);
+        semver::version_table::bitmap greater = table.select(semver::version_table::COLUMN_PATCH, semver::version_table::COMPARE_GREATER, 1);
+        semver::version_table::bitmap greater_equal = table.select(semver::version_table::COLUMN_MAJOR, semver::version_table::COMPARE_GREATER_EQUAL, 1);
+        semver::version_table::bitmap equal = table.select(semver::version_table::COLUMN_MINOR, semver::version_table::COMPARE_EQUAL, 2);
+        semver::version_table::bitmap stable = table.stable();
+        semver::version_table::bitmap pre_release = table.preRelease();
+
+        semver::version low("1.1.0-alpha.1");
+        semver::version high("2.1.0-rc.1");
+        semver::version_table::bitmap between = table.between(low, high);
+
+        BOOST_REQUIRE_EQUAL(between.size(), versions.size());
+
+        for (std::size_t i = 0; i < versions.size(); i++)
+        {
+            const semver::version& value = versions[i];
+
+            BOOST_CHECK_EQUAL(less.test(i), value.getMajor() < 2);
+            BOOST_CHECK_EQUAL(less_equal.test(i), value.getMinor() <= 1);
+            BOOST_CHECK_EQUAL(greater.test(i), value.getPatch() > 1);
+            BOOST_CHECK_EQUAL(greater_equal.test(i), value.getMajor() >= 1);
+            BOOST_CHECK_EQUAL(equal.test(i), value.getMinor() == 2);
+            BOOST_CHECK_EQUAL(stable.test(i), value.isStable());
+            BOOST_CHECK_EQUAL(pre_release.test(i), !value.getPreRelease().empty());
+            BOOST_CHECK_MESSAGE(between.test(i) == (!(value < low) && value < high), value.getVersion());
+        }
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
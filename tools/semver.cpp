@@ -0,0 +1,752 @@
+/**
+ * Semver - The Semantic Versioning
+ *
+ * (c) Axel Etcheverry <axel@etcheverry.biz>
+ *
+ * For the full copyright and license information, please view the LICENSE
+ * file that was distributed with this source code.
+ */
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <iterator>
+#include <limits>
+#include <string>
+#include <thread>
+#include <vector>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <semver/compare.hpp>
+#include <semver/range.hpp>
+
+namespace {
+
+    const char* const usage =
+        "Usage: semver <command> [options] [file]\n"
+        "\n"
+        "Reads newline separated versions from file, or from stdin.\n"
+        "\n"
+        "Commands:\n"
+        "  sort [-r] [-u]              sort valid versions by precedence\n"
+        "  max [--stable]              print the highest valid version\n"
+        "  filter --range <range>      print the versions in the range\n"
+        "  validate                    print the invalid lines\n"
+        "  bump major|minor|patch      print the next version of each line, a\n"
+        "                              pre-release of that version is released:\n"
+        "                              bump minor 1.3.0-rc.1 gives 1.3.0\n"
+        "\n"
+        "Options:\n"
+        "  -j <jobs>                   number of threads, defaults to the cores\n"
+        "  -r, --reverse               sort in descending order\n"
+        "  -u, --unique                drop duplicated versions\n"
+        "  --stable                    only keep stable versions\n";
+
+    struct options
+    {
+        std::string command;
+        std::string argument;
+        std::string range;
+        std::string file;
+        unsigned jobs;
+        bool reverse;
+        bool unique;
+        bool stable;
+    };
+
+    struct line
+    {
+        const char* data;
+        std::size_t length;
+    };
+
+    /**
+     * The input, memory mapped when it is a regular file, stdin included
+     */
+    class input
+    {
+    private:
+        std::string m_buffer;
+        void* m_map;
+        std::size_t m_size;
+        // where the input starts in the map, the file offset is not page
+        // aligned when stdin was partly read before
+        std::size_t m_offset;
+
+        /**
+         * Map a regular file from its current offset, read anything else
+         * (pipes, terminals) in large blocks
+         */
+        bool load(int fd)
+        {
+            struct stat info;
+
+            if (fstat(fd, &info) != 0)
+            {
+                return false;
+            }
+
+            if (!S_ISREG(info.st_mode))
+            {
+                std::size_t size = 0;
+
+                for (;;)
+                {
+                    m_buffer.resize(size + (1 << 20));
+
+                    ssize_t count = ::read(fd, &m_buffer[size], m_buffer.size() - size);
+
+                    if (count < 0 && errno == EINTR)
+                    {
+                        continue;
+                    }
+
+                    if (count <= 0)
+                    {
+                        m_buffer.resize(size);
+
+                        return count == 0;
+                    }
+
+                    size += static_cast<std::size_t>(count);
+                }
+            }
+
+            off_t start = lseek(fd, 0, SEEK_CUR);
+
+            if (start < 0)
+            {
+                return false;
+            }
+
+            if (start >= info.st_size)
+            {
+                return true;
+            }
+
+            off_t aligned = start - start % sysconf(_SC_PAGESIZE);
+
+            m_size = static_cast<std::size_t>(info.st_size - aligned);
+            m_offset = static_cast<std::size_t>(start - aligned);
+            m_map = mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, aligned);
+
+            if (m_map == MAP_FAILED)
+            {
+                m_map = nullptr;
+
+                return false;
+            }
+
+            madvise(m_map, m_size, MADV_SEQUENTIAL);
+
+            // consumed, as read() would have
+            lseek(fd, info.st_size, SEEK_SET);
+
+            return true;
+        }
+
+    public:
+        input()
+            : m_map(nullptr), m_size(0), m_offset(0)
+        {
+        }
+
+        ~input()
+        {
+            if (m_map)
+            {
+                munmap(m_map, m_size);
+            }
+        }
+
+        bool open(const std::string& file)
+        {
+            if (file.empty())
+            {
+                return load(STDIN_FILENO);
+            }
+
+            int fd = ::open(file.c_str(), O_RDONLY);
+
+            if (fd < 0)
+            {
+                return false;
+            }
+
+            bool result = load(fd);
+
+            close(fd);
+
+            return result;
+        }
+
+        const char* data() const
+        {
+            return m_map ? static_cast<const char*>(m_map) + m_offset : m_buffer.data();
+        }
+
+        std::size_t size() const
+        {
+            return m_map ? m_size - m_offset : m_buffer.size();
+        }
+    };
+
+    /**
+     * Split [begin, end) into lines without copying, \r\n endings and empty
+     * lines are dropped
+     */
+    void split(const char* begin, const char* end, std::vector<line>& lines)
+    {
+        while (begin < end)
+        {
+            const char* stop = static_cast<const char*>(std::memchr(begin, '\n', end - begin));
+
+            if (!stop)
+            {
+                stop = end;
+            }
+
+            std::size_t length = stop - begin;
+
+            if (length > 0 && begin[length - 1] == '\r')
+            {
+                length--;
+            }
+
+            if (length > 0)
+            {
+                line value = { begin, length };
+
+                lines.push_back(value);
+            }
+
+            begin = stop + 1;
+        }
+    }
+
+    /**
+     * Cut the input in jobs chunks on line boundaries and run work(chunk,
+     * lines) on each of them in its own thread
+     */
+    template <typename Work>
+    void parallel(const input& in, unsigned jobs, Work work)
+    {
+        const char* data = in.data();
+        const char* end = data + in.size();
+        std::vector<std::thread> threads;
+        const char* begin = data;
+
+        for (unsigned i = 0; i < jobs; i++)
+        {
+            const char* stop = (i + 1 == jobs) ? end : data + in.size() / jobs * (i + 1);
+
+            if (stop < begin)
+            {
+                stop = begin;
+            }
+
+            if (stop < end)
+            {
+                const char* newline = static_cast<const char*>(std::memchr(stop, '\n', end - stop));
+
+                stop = newline ? newline + 1 : end;
+            }
+
+            threads.push_back(std::thread([=]() {
+                std::vector<line> lines;
+
+                split(begin, stop, lines);
+                work(i, lines);
+            }));
+
+            begin = stop;
+        }
+
+        for (std::size_t i = 0; i < threads.size(); i++)
+        {
+            threads[i].join();
+        }
+    }
+
+    void write(const std::string& value)
+    {
+        std::fwrite(value.data(), 1, value.size(), stdout);
+    }
+
+    void append(std::string& out, const std::string& value)
+    {
+        out.append(value);
+        out += '\n';
+    }
+
+    void append(std::string& out, const line& value)
+    {
+        out.append(value.data, value.length);
+        out += '\n';
+    }
+
+    void invalid(const line& value)
+    {
+        std::string message = "semver: invalid version: " + std::string(value.data, value.length) + "\n";
+
+        std::fwrite(message.data(), 1, message.size(), stderr);
+    }
+
+    /**
+     * Precedence order, ties broken on the build so the output does not
+     * depend on the chunking
+     */
+    const semver::exact_less less = semver::exact_less();
+
+    /**
+     * A valid line to sort, pointing into the input
+     */
+    struct sortable
+    {
+        std::uint64_t major;
+        std::uint64_t minor;
+        std::uint64_t patch;
+        line text;
+        // has a pre-release or a build
+        bool suffix;
+    };
+
+    bool numbers_less(const sortable& lft, const sortable& rgt)
+    {
+        if (lft.major != rgt.major)
+        {
+            return lft.major < rgt.major;
+        }
+
+        if (lft.minor != rgt.minor)
+        {
+            return lft.minor < rgt.minor;
+        }
+
+        return lft.patch < rgt.patch;
+    }
+
+    bool text_equal(const sortable& lft, const sortable& rgt)
+    {
+        return lft.text.length == rgt.text.length && std::memcmp(lft.text.data, rgt.text.data, lft.text.length) == 0;
+    }
+
+    /**
+     * Order a run of lines with the same numbers by less, only these lines
+     * are parsed again. The buffers are reused from run to run.
+     */
+    struct run_sorter
+    {
+        std::vector<semver::version> versions;
+        std::vector<std::size_t> order;
+        std::vector<sortable> run;
+
+        void operator() (std::vector<sortable>::iterator first, std::vector<sortable>::iterator last)
+        {
+            versions.clear();
+            order.clear();
+            run.assign(first, last);
+
+            for (std::size_t i = 0; i < run.size(); i++)
+            {
+                versions.push_back(semver::version(run[i].text.data, run[i].text.length));
+                order.push_back(i);
+            }
+
+            std::sort(order.begin(), order.end(), [this](std::size_t lft, std::size_t rgt) {
+                return less(versions[lft], versions[rgt]);
+            });
+
+            for (std::size_t i = 0; i < order.size(); i++)
+            {
+                first[i] = run[order[i]];
+            }
+        }
+    };
+
+    int sort(const input& in, const options& opts)
+    {
+        std::vector<std::vector<sortable> > chunks(opts.jobs);
+
+        parallel(in, opts.jobs, [&](unsigned chunk, const std::vector<line>& lines) {
+            std::vector<sortable>& values = chunks[chunk];
+
+            values.reserve(lines.size());
+
+            for (std::size_t i = 0; i < lines.size(); i++)
+            {
+                semver::version value(lines[i].data, lines[i].length);
+
+                if (!value.isValid() || (opts.stable && !value.isStable()))
+                {
+                    if (!value.isValid())
+                    {
+                        invalid(lines[i]);
+                    }
+
+                    continue;
+                }
+
+                sortable entry = {
+                    value.getMajor(), value.getMinor(), value.getPatch(), lines[i],
+                    !value.getPreRelease().empty() || !value.getBuild().empty()
+                };
+
+                values.push_back(entry);
+            }
+
+            std::sort(values.begin(), values.end(), numbers_less);
+        });
+
+        std::vector<sortable> values;
+        run_sorter sort_run;
+
+        values.swap(chunks[0]);
+
+        for (std::size_t i = 1; i < chunks.size(); i++)
+        {
+            std::size_t middle = values.size();
+
+            values.insert(values.end(), chunks[i].begin(), chunks[i].end());
+            std::inplace_merge(values.begin(), values.begin() + middle, values.end(), numbers_less);
+            std::vector<sortable>().swap(chunks[i]);
+        }
+
+        // lines without pre-release nor build and the same numbers are the
+        // same text, the other runs are ordered on their parsed versions
+        for (std::vector<sortable>::iterator first = values.begin(); first != values.end();)
+        {
+            std::vector<sortable>::iterator last = first + 1;
+            bool suffix = first->suffix;
+
+            while (last != values.end() && !numbers_less(*first, *last))
+            {
+                suffix = suffix || last->suffix;
+                ++last;
+            }
+
+            if (suffix && last - first > 1)
+            {
+                sort_run(first, last);
+            }
+
+            first = last;
+        }
+
+        if (opts.unique)
+        {
+            values.erase(std::unique(values.begin(), values.end(), text_equal), values.end());
+        }
+
+        if (opts.reverse)
+        {
+            std::reverse(values.begin(), values.end());
+        }
+
+        std::string out;
+
+        for (std::size_t i = 0; i < values.size(); i++)
+        {
+            append(out, values[i].text);
+
+            if (out.size() > (1u << 20))
+            {
+                write(out);
+                out.clear();
+            }
+        }
+
+        write(out);
+
+        return 0;
+    }
+
+    int max(const input& in, const options& opts)
+    {
+        std::vector<std::vector<semver::version> > chunks(opts.jobs);
+
+        parallel(in, opts.jobs, [&](unsigned chunk, const std::vector<line>& lines) {
+            for (std::size_t i = 0; i < lines.size(); i++)
+            {
+                semver::version value(lines[i].data, lines[i].length);
+
+                if (!value.isValid() || (opts.stable && !value.isStable()))
+                {
+                    continue;
+                }
+
+                if (chunks[chunk].empty())
+                {
+                    chunks[chunk].push_back(value);
+                }
+                else if (less(chunks[chunk][0], value))
+                {
+                    chunks[chunk][0] = value;
+                }
+            }
+        });
+
+        const semver::version* result = nullptr;
+
+        for (std::size_t i = 0; i < chunks.size(); i++)
+        {
+            if (!chunks[i].empty() && (!result || less(*result, chunks[i][0])))
+            {
+                result = &chunks[i][0];
+            }
+        }
+
+        if (!result)
+        {
+            return 1;
+        }
+
+        write(result->getVersion() + "\n");
+
+        return 0;
+    }
+
+    int filter(const input& in, const options& opts)
+    {
+        semver::range range(opts.range);
+
+        if (!range.isValid())
+        {
+            std::cerr << "semver: invalid range: " << opts.range << std::endl;
+
+            return 2;
+        }
+
+        std::vector<std::string> chunks(opts.jobs);
+
+        parallel(in, opts.jobs, [&](unsigned chunk, const std::vector<line>& lines) {
+            for (std::size_t i = 0; i < lines.size(); i++)
+            {
+                semver::version value(lines[i].data, lines[i].length);
+
+                if (range.contains(value) && (!opts.stable || value.isStable()))
+                {
+                    append(chunks[chunk], lines[i]);
+                }
+            }
+        });
+
+        for (std::size_t i = 0; i < chunks.size(); i++)
+        {
+            write(chunks[i]);
+        }
+
+        return 0;
+    }
+
+    int validate(const input& in, const options& opts)
+    {
+        std::vector<std::string> chunks(opts.jobs);
+
+        parallel(in, opts.jobs, [&](unsigned chunk, const std::vector<line>& lines) {
+            for (std::size_t i = 0; i < lines.size(); i++)
+            {
+                if (!semver::version(lines[i].data, lines[i].length).isValid())
+                {
+                    append(chunks[chunk], lines[i]);
+                }
+            }
+        });
+
+        bool valid = true;
+
+        for (std::size_t i = 0; i < chunks.size(); i++)
+        {
+            valid = valid && chunks[i].empty();
+            write(chunks[i]);
+        }
+
+        return valid ? 0 : 1;
+    }
+
+    int bump(const input& in, const options& opts)
+    {
+        if (opts.argument != "major" && opts.argument != "minor" && opts.argument != "patch")
+        {
+            std::cerr << usage;
+
+            return 2;
+        }
+
+        std::vector<std::string> chunks(opts.jobs);
+        std::vector<char> failed(opts.jobs, 0);
+
+        parallel(in, opts.jobs, [&](unsigned chunk, const std::vector<line>& lines) {
+            for (std::size_t i = 0; i < lines.size(); i++)
+            {
+                semver::version value(lines[i].data, lines[i].length);
+                std::uint64_t major = value.getMajor();
+                std::uint64_t minor = value.getMinor();
+                std::uint64_t patch = value.getPatch();
+
+                std::uint64_t& bumped = (opts.argument == "major") ? major : (opts.argument == "minor") ? minor : patch;
+
+                // a pre-release of the bumped version is released instead
+                bool release = !value.getPreRelease().empty() &&
+                    (opts.argument == "patch" || (patch == 0 && (opts.argument == "minor" || minor == 0)));
+
+                if (!value.isValid() || (!release && bumped == std::numeric_limits<std::uint64_t>::max()))
+                {
+                    invalid(lines[i]);
+                    failed[chunk] = 1;
+
+                    continue;
+                }
+
+                // the pre-release and build of the current version are dropped
+                if (!release)
+                {
+                    bumped++;
+
+                    if (opts.argument == "major")
+                    {
+                        minor = 0;
+                    }
+
+                    if (opts.argument != "patch")
+                    {
+                        patch = 0;
+                    }
+                }
+
+                append(chunks[chunk], std::to_string(major) + "." + std::to_string(minor) + "." + std::to_string(patch));
+            }
+        });
+
+        for (std::size_t i = 0; i < chunks.size(); i++)
+        {
+            write(chunks[i]);
+        }
+
+        return (std::find(failed.begin(), failed.end(), 1) == failed.end()) ? 0 : 1;
+    }
+
+    bool parse_options(int argc, char** argv, options& opts)
+    {
+        if (argc < 2)
+        {
+            return false;
+        }
+
+        opts.command = argv[1];
+        opts.jobs = std::max(1u, std::thread::hardware_concurrency());
+        opts.reverse = false;
+        opts.unique = false;
+        opts.stable = false;
+
+        int i = 2;
+
+        if (opts.command == "bump")
+        {
+            if (argc < 3)
+            {
+                return false;
+            }
+
+            opts.argument = argv[i++];
+        }
+
+        for (; i < argc; i++)
+        {
+            std::string arg = argv[i];
+
+            if (arg == "-j" && i + 1 < argc)
+            {
+                opts.jobs = std::max(1, std::atoi(argv[++i]));
+            }
+            else if (arg == "-r" || arg == "--reverse")
+            {
+                opts.reverse = true;
+            }
+            else if (arg == "-u" || arg == "--unique")
+            {
+                opts.unique = true;
+            }
+            else if (arg == "--stable")
+            {
+                opts.stable = true;
+            }
+            else if (arg == "--range" && i + 1 < argc)
+            {
+                opts.range = argv[++i];
+            }
+            else if (arg[0] != '-' && opts.file.empty())
+            {
+                opts.file = arg;
+            }
+            else
+            {
+                return false;
+            }
+        }
+
+        return opts.command != "filter" || !opts.range.empty();
+    }
+
+} // end anonymous namespace
+
+int main(int argc, char** argv)
+{
+    options opts;
+    input in;
+
+    if (!parse_options(argc, argv, opts))
+    {
+        std::cerr << usage;
+
+        return 2;
+    }
+
+    if (!in.open(opts.file))
+    {
+        std::cerr << "semver: cannot read " << opts.file << std::endl;
+
+        return 2;
+    }
+
+    // small inputs are not worth the threads
+    if (in.size() < (1 << 16))
+    {
+        opts.jobs = 1;
+    }
+
+    if (opts.command == "sort")
+    {
+        return sort(in, opts);
+    }
+
+    if (opts.command == "max")
+    {
+        return max(in, opts);
+    }
+
+    if (opts.command == "filter")
+    {
+        return filter(in, opts);
+    }
+
+    if (opts.command == "validate")
+    {
+        return validate(in, opts);
+    }
+
+    if (opts.command == "bump")
+    {
+        return bump(in, opts);
+    }
+
+    std::cerr << usage;
+
+    return 2;
+}